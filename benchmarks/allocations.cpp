@@ -0,0 +1,34 @@
+#include "allocations.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace sqlgen_benchmarks {
+
+static std::atomic<size_t> allocation_counter = 0;
+
+size_t num_allocations() noexcept {
+  return allocation_counter.load(std::memory_order_relaxed);
+}
+
+}  // namespace sqlgen_benchmarks
+
+void* operator new(std::size_t _size) {
+  sqlgen_benchmarks::allocation_counter.fetch_add(1,
+                                                  std::memory_order_relaxed);
+  if (void* ptr = std::malloc(_size == 0 ? 1 : _size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t _size) { return ::operator new(_size); }
+
+void operator delete(void* _ptr) noexcept { std::free(_ptr); }
+
+void operator delete(void* _ptr, std::size_t) noexcept { std::free(_ptr); }
+
+void operator delete[](void* _ptr) noexcept { std::free(_ptr); }
+
+void operator delete[](void* _ptr, std::size_t) noexcept { std::free(_ptr); }
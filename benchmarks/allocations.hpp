@@ -0,0 +1,14 @@
+#ifndef SQLGEN_BENCHMARKS_ALLOCATIONS_HPP_
+#define SQLGEN_BENCHMARKS_ALLOCATIONS_HPP_
+
+#include <cstddef>
+
+namespace sqlgen_benchmarks {
+
+/// The total number of calls to the global operator new so far. The counting
+/// operator new is defined in allocations.cpp.
+size_t num_allocations() noexcept;
+
+}  // namespace sqlgen_benchmarks
+
+#endif
@@ -0,0 +1,114 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <sqlgen.hpp>
+#include <sqlgen/dynamic/Statement.hpp>
+#include <sqlgen/internal/LRUCache.hpp>
+#include <sqlgen/internal/hash_statement.hpp>
+#include <sqlgen/sqlite/to_sql.hpp>
+#include <string>
+#include <vector>
+
+namespace sqlgen_benchmarks {
+
+using namespace sqlgen::dynamic;
+
+/// The number of entries in the cache.
+constexpr size_t NUM_ENTRIES = 100000;
+
+using StatementHash = sqlgen::internal::StatementHash;
+
+using LRUCache =
+    sqlgen::internal::LRUCache<StatementHash, int64_t, StatementHash::Hasher>;
+
+static SelectFrom::Field make_field(const std::string& _name) {
+  return SelectFrom::Field{.val = Operation{.val = Column{.name = _name}}};
+}
+
+/// SELECT ... FROM "Person" WHERE "first_name" = '...' AND "age" > _i
+static Statement make_select(const int64_t _i) {
+  return SelectFrom{
+      .table_or_query = Table{.name = "Person"},
+      .fields = {make_field("id"), make_field("first_name"), make_field("age")},
+      .where = Condition{
+          .val = Condition::And{
+              .cond1 = sqlgen::Ref<Condition>::make(Condition{
+                  .val = Condition::Equal{
+                      .op1 = Operation{.val = Column{.name = "first_name"}},
+                      .op2 = Operation{
+                          .val = Value{.val = String{.val = "Homer"}}}}}),
+              .cond2 = sqlgen::Ref<Condition>::make(Condition{
+                  .val = Condition::GreaterThan{
+                      .op1 = Operation{.val = Column{.name = "age"}},
+                      .op2 = Operation{.val = Value{
+                                           .val = Integer{.val = _i}}}}})}}};
+}
+
+static StatementHash make_key(const int64_t _i) {
+  return sqlgen::internal::encode_statement(make_select(_i)).hash;
+}
+
+static void fill(LRUCache* _cache) {
+  for (size_t i = 0; i < NUM_ENTRIES; ++i) {
+    _cache->put(make_key(static_cast<int64_t>(i)), static_cast<int64_t>(i));
+  }
+}
+
+/// How long it takes to compute the cache key of a statement...
+static void BM_cache_key_hash(benchmark::State& _state) {
+  const auto stmt = make_select(42);
+  for (auto _ : _state) {
+    auto key = sqlgen::internal::encode_statement(stmt);
+    benchmark::DoNotOptimize(key);
+  }
+}
+
+BENCHMARK(BM_cache_key_hash);
+
+/// ...compared to rendering it to SQL, which is what the key used to be.
+static void BM_cache_key_render(benchmark::State& _state) {
+  const auto stmt = make_select(42);
+  for (auto _ : _state) {
+    auto sql = sqlgen::sqlite::to_sql_impl(stmt);
+    benchmark::DoNotOptimize(sql);
+  }
+}
+
+BENCHMARK(BM_cache_key_render);
+
+/// Looks up entries that are in a full cache.
+static void BM_cache_hit(benchmark::State& _state) {
+  LRUCache cache(NUM_ENTRIES);
+  fill(&cache);
+  std::vector<StatementHash> keys;
+  for (size_t i = 0; i < NUM_ENTRIES; i += 97) {
+    keys.push_back(make_key(static_cast<int64_t>(i)));
+  }
+  size_t i = 0;
+  for (auto _ : _state) {
+    auto value = cache.get(keys[i++ % keys.size()]);
+    benchmark::DoNotOptimize(value);
+  }
+}
+
+BENCHMARK(BM_cache_hit);
+
+/// Inserts new entries into a full cache, so that every insert evicts the
+/// least recently used entry.
+static void BM_cache_insert_and_evict(benchmark::State& _state) {
+  LRUCache cache(NUM_ENTRIES);
+  fill(&cache);
+  std::vector<StatementHash> keys;
+  for (size_t i = 0; i < NUM_ENTRIES; ++i) {
+    keys.push_back(make_key(static_cast<int64_t>(NUM_ENTRIES + i)));
+  }
+  size_t i = 0;
+  for (auto _ : _state) {
+    cache.put(keys[i % keys.size()], static_cast<int64_t>(i));
+    ++i;
+  }
+}
+
+BENCHMARK(BM_cache_insert_and_evict);
+
+}  // namespace sqlgen_benchmarks
@@ -0,0 +1,45 @@
+#include <benchmark/benchmark.h>
+
+#include <sqlgen.hpp>
+#include <string>
+
+namespace sqlgen_benchmarks {
+
+/// A connection that does nothing, so that we only measure the pool itself.
+struct NullConnection {
+  NullConnection(const size_t) {}
+
+  sqlgen::Result<sqlgen::Nothing> execute(const std::string&) {
+    return sqlgen::Nothing{};
+  }
+};
+
+/// The number of connections in the pool. Most runs use more threads than
+/// that, so they also measure how the pool behaves when threads need to wait.
+constexpr size_t POOL_SIZE = 16;
+
+static sqlgen::ConnectionPool<NullConnection>& get_pool() {
+  static auto pool = sqlgen::ConnectionPool<NullConnection>(
+      sqlgen::ConnectionPoolConfig{.size = POOL_SIZE}, size_t(0));
+  return pool;
+}
+
+/// Acquires and releases a session as fast as possible from all threads.
+static void BM_connection_pool_acquire(benchmark::State& _state) {
+  auto& pool = get_pool();
+  for (auto _ : _state) {
+    auto session = pool.acquire();
+    benchmark::DoNotOptimize(session);
+  }
+  _state.SetItemsProcessed(static_cast<int64_t>(_state.iterations()));
+}
+
+BENCHMARK(BM_connection_pool_acquire)
+    ->Threads(1)
+    ->Threads(8)
+    ->Threads(16)
+    ->Threads(64)
+    ->Threads(128)
+    ->UseRealTime();
+
+}  // namespace sqlgen_benchmarks
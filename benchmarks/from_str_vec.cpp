@@ -0,0 +1,21 @@
+#include <benchmark/benchmark.h>
+
+#include <sqlgen.hpp>
+#include <sqlgen/internal/from_str_vec.hpp>
+
+#include "wide_row.hpp"
+
+namespace sqlgen_benchmarks {
+
+static void BM_from_str_vec_wide_row(benchmark::State& _state) {
+  const auto batch = make_wide_row_batch(1);
+  for (auto _ : _state) {
+    auto res = sqlgen::internal::from_str_vec<WideRow>(batch[0]);
+    benchmark::DoNotOptimize(res);
+  }
+  _state.SetItemsProcessed(_state.iterations());
+}
+
+BENCHMARK(BM_from_str_vec_wide_row);
+
+}  // namespace sqlgen_benchmarks
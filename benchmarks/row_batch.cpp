@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <optional>
+#include <sqlgen.hpp>
+#include <sqlgen/internal/RowBatch.hpp>
+#include <sqlgen/internal/from_str_vec.hpp>
+#include <string>
+#include <vector>
+
+#include "allocations.hpp"
+#include "wide_row.hpp"
+
+namespace sqlgen_benchmarks {
+
+constexpr size_t NUM_ROWS = 1000;
+
+static void set_allocations_per_row(benchmark::State& _state,
+                                    const size_t _num_allocations) {
+  _state.counters["allocations_per_row"] =
+      static_cast<double>(_num_allocations) /
+      static_cast<double>(_state.iterations() * NUM_ROWS);
+  _state.SetItemsProcessed(
+      static_cast<int64_t>(_state.iterations() * NUM_ROWS));
+}
+
+/// The format the backends used to return before RowBatch, for comparison.
+static void BM_build_nested_vectors(benchmark::State& _state) {
+  const auto row = make_wide_row_strings();
+  const auto before = num_allocations();
+  for (auto _ : _state) {
+    std::vector<std::vector<std::optional<std::string>>> batch;
+    for (size_t i = 0; i < NUM_ROWS; ++i) {
+      std::vector<std::optional<std::string>> new_row;
+      for (const auto& cell : row) {
+        new_row.emplace_back(cell);
+      }
+      batch.emplace_back(std::move(new_row));
+    }
+    benchmark::DoNotOptimize(batch);
+  }
+  set_allocations_per_row(_state, num_allocations() - before);
+}
+
+BENCHMARK(BM_build_nested_vectors);
+
+static void BM_build_row_batch(benchmark::State& _state) {
+  const auto row = make_wide_row_strings();
+  const auto before = num_allocations();
+  for (auto _ : _state) {
+    sqlgen::internal::RowBatch batch;
+    for (size_t i = 0; i < NUM_ROWS; ++i) {
+      for (const auto& cell : row) {
+        if (cell) {
+          batch.append(*cell);
+        } else {
+          batch.append_null();
+        }
+      }
+      batch.end_row();
+    }
+    benchmark::DoNotOptimize(batch);
+  }
+  set_allocations_per_row(_state, num_allocations() - before);
+}
+
+BENCHMARK(BM_build_row_batch);
+
+static void BM_decode_row_batch(benchmark::State& _state) {
+  const auto batch = make_wide_row_batch(NUM_ROWS);
+  const auto before = num_allocations();
+  for (auto _ : _state) {
+    for (size_t i = 0; i < batch.size(); ++i) {
+      auto res = sqlgen::internal::from_str_vec<WideRow>(batch[i]);
+      benchmark::DoNotOptimize(res);
+    }
+  }
+  set_allocations_per_row(_state, num_allocations() - before);
+}
+
+BENCHMARK(BM_decode_row_batch);
+
+}  // namespace sqlgen_benchmarks
@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+
+#include <sqlgen.hpp>
+#include <sqlgen/dynamic/Statement.hpp>
+#include <sqlgen/sqlite/to_sql.hpp>
+#include <string>
+
+#include "allocations.hpp"
+
+namespace sqlgen_benchmarks {
+
+using namespace sqlgen::dynamic;
+
+/// The depth of the condition and operation trees.
+constexpr size_t DEPTH = 64;
+
+/// Builds ("x" + 1) + 2) + ... with _depth nested additions.
+static Operation make_deep_operation(const size_t _depth) {
+  auto op = Operation{.val = Column{.name = "x"}};
+  for (size_t i = 0; i < _depth; ++i) {
+    op = Operation{
+        .val = Operation::Plus{
+            .op1 = sqlgen::Ref<Operation>::make(op),
+            .op2 = sqlgen::Ref<Operation>::make(Operation{
+                .val = Value{.val = Integer{.val = static_cast<int64_t>(i)}}})}};
+  }
+  return op;
+}
+
+/// Builds a left-deep tree of alternating AND and OR conditions, each
+/// comparing a column against a string.
+static Condition make_deep_condition(const size_t _depth) {
+  const auto make_leaf = [](const size_t _i) {
+    return Condition{
+        .val = Condition::Equal{
+            .op1 = Operation{.val = Column{.name = "name"}},
+            .op2 = Operation{
+                .val = Value{.val = String{.val = "Simpson's " +
+                                                  std::to_string(_i)}}}}};
+  };
+  auto cond = make_leaf(0);
+  for (size_t i = 1; i <= _depth; ++i) {
+    const auto cond1 = sqlgen::Ref<Condition>::make(cond);
+    const auto cond2 = sqlgen::Ref<Condition>::make(make_leaf(i));
+    if (i % 2 == 0) {
+      cond = Condition{.val = Condition::And{.cond1 = cond1, .cond2 = cond2}};
+    } else {
+      cond = Condition{.val = Condition::Or{.cond1 = cond1, .cond2 = cond2}};
+    }
+  }
+  return cond;
+}
+
+static Statement make_deep_select() {
+  return SelectFrom{
+      .table_or_query = Table{.name = "Person"},
+      .fields = {SelectFrom::Field{.val = make_deep_operation(DEPTH),
+                                   .as = "total"}},
+      .where = make_deep_condition(DEPTH)};
+}
+
+static void set_allocations_per_statement(benchmark::State& _state,
+                                          const size_t _num_allocations) {
+  _state.counters["allocations_per_statement"] =
+      static_cast<double>(_num_allocations) /
+      static_cast<double>(_state.iterations());
+  _state.SetItemsProcessed(static_cast<int64_t>(_state.iterations()));
+}
+
+static void BM_to_sql_deep_tree(benchmark::State& _state) {
+  const auto stmt = make_deep_select();
+  const auto before = num_allocations();
+  for (auto _ : _state) {
+    auto sql = sqlgen::sqlite::to_sql_impl(stmt);
+    benchmark::DoNotOptimize(sql);
+  }
+  set_allocations_per_statement(_state, num_allocations() - before);
+}
+
+BENCHMARK(BM_to_sql_deep_tree);
+
+/// Reuses the same buffer for every statement, which is what a caller
+/// transpiling many statements in a row would do.
+static void BM_to_sql_into_deep_tree(benchmark::State& _state) {
+  const auto stmt = make_deep_select();
+  std::string sql;
+  const auto before = num_allocations();
+  for (auto _ : _state) {
+    sql.clear();
+    sqlgen::sqlite::to_sql_into(stmt, &sql);
+    benchmark::DoNotOptimize(sql);
+  }
+  set_allocations_per_statement(_state, num_allocations() - before);
+}
+
+BENCHMARK(BM_to_sql_into_deep_tree);
+
+}  // namespace sqlgen_benchmarks
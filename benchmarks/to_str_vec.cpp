@@ -0,0 +1,38 @@
+#include <benchmark/benchmark.h>
+
+#include <sqlgen.hpp>
+#include <sqlgen/internal/RowBatch.hpp>
+#include <sqlgen/internal/from_str_vec.hpp>
+#include <sqlgen/internal/to_str_vec.hpp>
+#include <vector>
+
+#include "allocations.hpp"
+#include "wide_row.hpp"
+
+namespace sqlgen_benchmarks {
+
+static void BM_to_str_vec_wide_row(benchmark::State& _state) {
+  constexpr size_t num_rows = 1000;
+  const auto batch = make_wide_row_batch(1);
+  const auto row = sqlgen::internal::from_str_vec<WideRow>(batch[0]).value();
+  const auto rows = std::vector<WideRow>(num_rows, row);
+
+  sqlgen::internal::RowBatch data;
+  const auto before = num_allocations();
+  for (auto _ : _state) {
+    data.clear();
+    for (const auto& r : rows) {
+      sqlgen::internal::to_str_vec(r, &data);
+    }
+    benchmark::DoNotOptimize(data);
+  }
+  _state.counters["allocations_per_row"] =
+      static_cast<double>(num_allocations() - before) /
+      static_cast<double>(_state.iterations() * num_rows);
+  _state.SetItemsProcessed(
+      static_cast<int64_t>(_state.iterations() * num_rows));
+}
+
+BENCHMARK(BM_to_str_vec_wide_row);
+
+}  // namespace sqlgen_benchmarks
@@ -0,0 +1,139 @@
+#ifndef SQLGEN_BENCHMARKS_WIDE_ROW_HPP_
+#define SQLGEN_BENCHMARKS_WIDE_ROW_HPP_
+
+#include <cstdint>
+#include <optional>
+#include <sqlgen/internal/RowBatch.hpp>
+#include <string>
+#include <vector>
+
+namespace sqlgen_benchmarks {
+
+/// A table with 80 columns, cycling through the most common column types.
+struct WideRow {
+  int32_t c0;
+  double c1;
+  std::string c2;
+  std::optional<int64_t> c3;
+  int32_t c4;
+  double c5;
+  std::string c6;
+  std::optional<int64_t> c7;
+  int32_t c8;
+  double c9;
+  std::string c10;
+  std::optional<int64_t> c11;
+  int32_t c12;
+  double c13;
+  std::string c14;
+  std::optional<int64_t> c15;
+  int32_t c16;
+  double c17;
+  std::string c18;
+  std::optional<int64_t> c19;
+  int32_t c20;
+  double c21;
+  std::string c22;
+  std::optional<int64_t> c23;
+  int32_t c24;
+  double c25;
+  std::string c26;
+  std::optional<int64_t> c27;
+  int32_t c28;
+  double c29;
+  std::string c30;
+  std::optional<int64_t> c31;
+  int32_t c32;
+  double c33;
+  std::string c34;
+  std::optional<int64_t> c35;
+  int32_t c36;
+  double c37;
+  std::string c38;
+  std::optional<int64_t> c39;
+  int32_t c40;
+  double c41;
+  std::string c42;
+  std::optional<int64_t> c43;
+  int32_t c44;
+  double c45;
+  std::string c46;
+  std::optional<int64_t> c47;
+  int32_t c48;
+  double c49;
+  std::string c50;
+  std::optional<int64_t> c51;
+  int32_t c52;
+  double c53;
+  std::string c54;
+  std::optional<int64_t> c55;
+  int32_t c56;
+  double c57;
+  std::string c58;
+  std::optional<int64_t> c59;
+  int32_t c60;
+  double c61;
+  std::string c62;
+  std::optional<int64_t> c63;
+  int32_t c64;
+  double c65;
+  std::string c66;
+  std::optional<int64_t> c67;
+  int32_t c68;
+  double c69;
+  std::string c70;
+  std::optional<int64_t> c71;
+  int32_t c72;
+  double c73;
+  std::string c74;
+  std::optional<int64_t> c75;
+  int32_t c76;
+  double c77;
+  std::string c78;
+  std::optional<int64_t> c79;
+};
+
+/// The string representation of a single WideRow, as a backend would return
+/// it.
+inline std::vector<std::optional<std::string>> make_wide_row_strings() {
+  std::vector<std::optional<std::string>> row;
+  row.reserve(80);
+  for (int i = 0; i < 80; ++i) {
+    switch (i % 4) {
+      case 0:
+        row.emplace_back(std::to_string(i));
+        break;
+      case 1:
+        row.emplace_back(std::to_string(i) + ".5");
+        break;
+      case 2:
+        row.emplace_back("some_string_value_" + std::to_string(i));
+        break;
+      default:
+        row.emplace_back(std::nullopt);
+        break;
+    }
+  }
+  return row;
+}
+
+/// A batch of _num_rows identical WideRows, as a backend would return it.
+inline sqlgen::internal::RowBatch make_wide_row_batch(const size_t _num_rows) {
+  const auto row = make_wide_row_strings();
+  sqlgen::internal::RowBatch batch;
+  for (size_t i = 0; i < _num_rows; ++i) {
+    for (const auto& cell : row) {
+      if (cell) {
+        batch.append(*cell);
+      } else {
+        batch.append_null();
+      }
+    }
+    batch.end_row();
+  }
+  return batch;
+}
+
+}  // namespace sqlgen_benchmarks
+
+#endif
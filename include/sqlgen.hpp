@@ -2,6 +2,7 @@
 #define SQLGEN_HPP_
 
 #include "sqlgen/ConnectionPool.hpp"
+#include "sqlgen/ConnectionPoolMetrics.hpp"
 #include "sqlgen/Flatten.hpp"
 #include "sqlgen/ForeignKey.hpp"
 #include "sqlgen/Iterator.hpp"
@@ -12,12 +13,15 @@
 #include "sqlgen/Range.hpp"
 #include "sqlgen/Ref.hpp"
 #include "sqlgen/Result.hpp"
+#include "sqlgen/RoutingPool.hpp"
+#include "sqlgen/RoutingSession.hpp"
 #include "sqlgen/Session.hpp"
 #include "sqlgen/Timestamp.hpp"
 #include "sqlgen/Unique.hpp"
 #include "sqlgen/Varchar.hpp"
 #include "sqlgen/aggregations.hpp"
 #include "sqlgen/as.hpp"
+#include "sqlgen/batch_size.hpp"
 #include "sqlgen/begin_transaction.hpp"
 #include "sqlgen/cache.hpp"
 #include "sqlgen/cascade.hpp"
@@ -39,7 +43,9 @@
 #include "sqlgen/literals.hpp"
 #include "sqlgen/operations.hpp"
 #include "sqlgen/order_by.hpp"
+#include "sqlgen/parallel_decode.hpp"
 #include "sqlgen/patterns.hpp"
+#include "sqlgen/prefetch.hpp"
 #include "sqlgen/read.hpp"
 #include "sqlgen/rollback.hpp"
 #include "sqlgen/select_from.hpp"
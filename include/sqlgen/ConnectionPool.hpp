@@ -1,39 +1,213 @@
 #ifndef SQLGEN_CONNECTIONPOOL_HPP_
 #define SQLGEN_CONNECTIONPOOL_HPP_
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <limits>
 #include <memory>
-#include <numeric>
-#include <thread>
+#include <mutex>
+#include <stdexcept>
+#include <optional>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "ConnectionPoolMetrics.hpp"
 #include "Ref.hpp"
 #include "Result.hpp"
 #include "Session.hpp"
+#include "internal/AtomicHistogram.hpp"
 
 namespace sqlgen {
 
 struct ConnectionPoolConfig {
+  /// The number of connections in the pool, unless min_size or max_size are
+  /// set.
   size_t size = 4;
+
+  /// The number of connections that are opened when the pool is created and
+  /// kept open, even when they are idle. Defaults to size.
+  std::optional<size_t> min_size = std::nullopt;
+
+  /// The maximum number of connections. Connections beyond min_size are only
+  /// opened once all others are in use. Defaults to the larger of size and
+  /// min_size.
+  std::optional<size_t> max_size = std::nullopt;
+
+  /// How long acquire() waits for a connection to become available, before
+  /// returning an error. Defaults to (num_attempts - 1) *
+  /// wait_time_in_seconds, which is how long the pool used to wait.
+  std::optional<std::chrono::milliseconds> timeout = std::nullopt;
+
+  /// Connections beyond min_size are closed, once they have been idle for
+  /// this long.
+  std::chrono::milliseconds idle_timeout = std::chrono::seconds(60);
+
+  /// Statements executed on every new connection, before it is handed out,
+  /// for instance to set session parameters or to prepare statements.
+  std::vector<std::string> init_sql = {};
+
+  /// Only used to determine the default timeout.
   size_t num_attempts = 10;
+
+  /// Only used to determine the default timeout.
   size_t wait_time_in_seconds = 1;
 };
 
+/// A pool of connections that can be shared between threads. Copies of the
+/// pool share the same connections.
+///
+/// Every connection lives in one of max_size slots. Acquiring and releasing a
+/// connection is lock-free, as long as nobody has to wait: A thread first
+/// tries to claim the slot it used last, which keeps connections warm and
+/// spreads the threads over different cache lines, and then takes a slot
+/// from a lock-free free list of released connections.
+///
+/// Only when all connections are in use, acquire() takes a mutex, opens a new
+/// connection, if fewer than max_size are open, or blocks until one is
+/// released or the timeout expires. As long as threads are waiting, released
+/// connections are handed directly to the thread that has been waiting the
+/// longest, so that no thread can be starved by others that happen to arrive
+/// at the right moment.
 template <class Connection>
 class ConnectionPool {
   using ConnPtr = Ref<Connection>;
 
+  using Clock = std::chrono::steady_clock;
+
+  /// Marks the end of the free list or the absence of a slot.
+  static constexpr uint32_t NO_SLOT = std::numeric_limits<uint32_t>::max();
+
+  /// A place for a single connection.
+  struct Slot {
+    /// The connection, if the slot is not empty. This may only be accessed by
+    /// the thread that owns the slot, either through a session or because it
+    /// has claimed the idle slot.
+    std::optional<ConnPtr> conn;
+
+    /// Whether the slot contains an idle connection that can be claimed.
+    std::atomic<bool> idle = false;
+
+    /// Whether the slot is on the free list. A slot can be claimed without
+    /// going through the free list, so the free list may contain slots that
+    /// are no longer idle, which are skipped. This flag ensures that a slot is
+    /// never on the free list twice.
+    std::atomic<bool> on_free_list = false;
+
+    /// The next slot on the free list.
+    std::atomic<uint32_t> next = NO_SLOT;
+
+    /// When the connection was released, as a Clock::duration::rep.
+    std::atomic<Clock::rep> released_at = 0;
+
+    /// When the connection was handed out. Like conn, this may only be
+    /// accessed by the thread that owns the slot.
+    Clock::time_point acquired_at;
+  };
+
+  /// A thread that is blocked in acquire(). It lives on the stack of that
+  /// thread and is only accessed while holding the mutex.
+  struct Waiter {
+    std::condition_variable cv;
+    uint32_t slot = NO_SLOT;
+  };
+
+  /// The state shared by all copies of the pool and the sessions it has
+  /// handed out, so that sessions can be released after the pool is gone.
+  struct State {
+    /// Identifies the pool in last_slot(). Unlike the address of the state,
+    /// this is never reused by a later pool.
+    uint64_t id = make_id();
+
+    /// Opens a new connection and runs the init_sql. Throws on failure.
+    std::function<ConnPtr()> make_conn;
+
+    size_t min_size;
+
+    size_t max_size;
+
+    std::chrono::milliseconds timeout;
+
+    std::chrono::milliseconds idle_timeout;
+
+    /// The max_size slots.
+    std::unique_ptr<Slot[]> slots;
+
+    /// The top of the free list in the lower 32 bits and a counter that is
+    /// incremented on every change in the upper 32 bits, which prevents the
+    /// ABA problem.
+    std::atomic<uint64_t> free_list = NO_SLOT;
+
+    /// The number of threads in waiters. This is what allows releasing a
+    /// connection without taking the mutex while nobody is waiting.
+    std::atomic<size_t> num_waiters = 0;
+
+    /// When idle connections should be looked at next, as a
+    /// Clock::duration::rep.
+    std::atomic<Clock::rep> next_expiry_check = 0;
+
+    /// The metrics, see ConnectionPoolMetrics.
+    std::atomic<size_t> num_in_use = 0;
+
+    std::atomic<size_t> peak_in_use = 0;
+
+    std::atomic<uint64_t> num_timeouts = 0;
+
+    internal::AtomicHistogram wait_time;
+
+    internal::AtomicHistogram hold_time;
+
+    /// Protects everything below.
+    std::mutex mtx;
+
+    /// The slots that do not contain a connection.
+    std::vector<uint32_t> empty_slots;
+
+    /// The threads waiting for a connection, in the order they arrived.
+    std::deque<Waiter*> waiters;
+
+    /// The number of connections that are open or being opened, whether they
+    /// are in use or not.
+    size_t num_open = 0;
+  };
+
  public:
   template <class... Args>
-  ConnectionPool(const ConnectionPoolConfig& _config, const Args&... _args) {
-    conns_->reserve(_config.size);
-    for (size_t i = 0; i < _config.size; ++i) {
-      auto conn = Ref<Connection>::make(_args...);
-      auto flag = Ref<std::atomic_flag>::make();
-      flag->clear();
-      conns_->emplace_back(std::make_pair(std::move(conn), std::move(flag)));
+  ConnectionPool(const ConnectionPoolConfig& _config, const Args&... _args)
+      : state_(make_state(_config, _args...)) {
+    if (state_->min_size == 0) {
+      return;
+    }
+
+    // The first connection is opened on this thread, so that client libraries
+    // that initialize themselves on the first connection do not race. The
+    // others are opened concurrently, so that the handshakes overlap.
+    auto first = state_->make_conn();
+
+    std::vector<std::future<ConnPtr>> futures;
+    futures.reserve(state_->min_size - 1);
+    for (size_t i = 1; i < state_->min_size; ++i) {
+      futures.emplace_back(std::async(std::launch::async, state_->make_conn));
+    }
+
+    std::vector<ConnPtr> conns = {first};
+    for (auto& fut : futures) {
+      conns.emplace_back(fut.get());
+    }
+
+    std::lock_guard<std::mutex> lock(state_->mtx);
+    for (const auto& conn : conns) {
+      const auto ix = state_->empty_slots.back();
+      state_->empty_slots.pop_back();
+      state_->slots[ix].conn = conn;
+      ++state_->num_open;
+      make_idle(state_, ix);
     }
   }
 
@@ -49,40 +223,342 @@ class ConnectionPool {
 
   ~ConnectionPool() = default;
 
-  /// Acquire a session from the pool. Returns an error if no connections are
-  /// available after several attempts.
+  /// Acquire a session from the pool. If all connections are in use and no
+  /// new ones can be opened, this waits for a connection to be released and
+  /// returns an error, if none is released before the timeout.
   Result<Ref<Session<Connection>>> acquire() noexcept {
-    for (size_t att = 0; att < config_.num_attempts; ++att) {
-      if (att != 0) {
-        std::this_thread::sleep_for(
-            std::chrono::seconds(config_.wait_time_in_seconds));
+    return acquire_impl(true);
+  }
+
+  /// Like acquire(), but returns an error right away instead of waiting, if
+  /// all connections are in use and no new ones can be opened.
+  Result<Ref<Session<Connection>>> try_acquire() noexcept {
+    return acquire_impl(false);
+  }
+
+  /// Get the number of sessions that can be acquired without waiting.
+  size_t available() const {
+    std::lock_guard<std::mutex> lock(state_->mtx);
+    size_t num_idle = 0;
+    for (size_t i = 0; i < state_->max_size; ++i) {
+      if (state_->slots[i].idle) {
+        ++num_idle;
       }
-      for (auto& [conn, flag] : *conns_) {
-        if (!flag->test_and_set()) {
-          return Ref<Session<Connection>>::make(conn, flag);
+    }
+    return num_idle + state_->max_size - state_->num_open;
+  }
+
+  /// Get the number of connections that are currently open.
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(state_->mtx);
+    return state_->num_open;
+  }
+
+  /// Get a snapshot of the metrics, for instance to export them to a
+  /// monitoring system. Recording the metrics only takes a few atomic
+  /// operations per session, so they are always on.
+  ConnectionPoolMetrics metrics() const {
+    return ConnectionPoolMetrics{
+        .size = size(),
+        .max_size = state_->max_size,
+        .in_use = state_->num_in_use,
+        .peak_in_use = state_->peak_in_use,
+        .num_waiting = state_->num_waiters,
+        .num_timeouts = state_->num_timeouts,
+        .wait_time = state_->wait_time.snapshot(),
+        .hold_time = state_->hold_time.snapshot()};
+  }
+
+ private:
+  template <class... Args>
+  static Ref<State> make_state(const ConnectionPoolConfig& _config,
+                               const Args&... _args) {
+    auto state = Ref<State>::make();
+    state->make_conn = [init_sql = _config.init_sql, _args...]() {
+      const auto conn = Ref<Connection>::make(_args...);
+      for (const auto& sql : init_sql) {
+        const auto res = conn->execute(sql);
+        if (!res) {
+          throw std::runtime_error(res.error().what());
         }
       }
+      return conn;
+    };
+    state->min_size = _config.min_size.value_or(_config.size);
+    state->max_size = std::clamp(
+        _config.max_size.value_or(std::max(_config.size, state->min_size)),
+        size_t(1), size_t(NO_SLOT));
+    state->min_size = std::min(state->min_size, state->max_size);
+    state->timeout = _config.timeout.value_or(std::chrono::seconds(
+        _config.num_attempts == 0
+            ? 0
+            : (_config.num_attempts - 1) * _config.wait_time_in_seconds));
+    state->idle_timeout = _config.idle_timeout;
+    state->slots = std::make_unique<Slot[]>(state->max_size);
+    state->empty_slots.reserve(state->max_size);
+    for (size_t i = state->max_size; i > 0; --i) {
+      state->empty_slots.push_back(static_cast<uint32_t>(i - 1));
     }
-    return error("No available connections in the pool.");
+    return state;
   }
 
-  /// Get the current number of available connections
-  size_t available() const {
-    return std::accumulate(conns_->begin(), conns_->end(), 0,
-                           [](const auto _count, const auto& _p) {
-                             return _p.second->test() ? _count : _count + 1;
-                           });
+  Result<Ref<Session<Connection>>> acquire_impl(const bool _wait) noexcept {
+    try {
+      const auto start = Clock::now();
+
+      remove_expired_if_due();
+
+      // Threads that are already waiting go first.
+      if (state_->num_waiters == 0) {
+        const auto ix = claim(state_.get());
+        if (ix != NO_SLOT) {
+          return make_session(ix, start);
+        }
+      }
+
+      return acquire_slow(start, _wait);
+
+    } catch (std::exception& e) {
+      return error(e.what());
+    }
   }
 
-  /// Get the total number of connections in the pool
-  size_t size() const { return conns_->size(); }
+  /// Queues up behind the threads that are already waiting. If _wait is
+  /// false, this gives up as soon as it would have to block.
+  Result<Ref<Session<Connection>>> acquire_slow(
+      const Clock::time_point _start, const bool _wait) {
+    const auto deadline = _wait ? _start + state_->timeout : _start;
 
- private:
-  /// The configuration for the connection pool.
-  ConnectionPoolConfig config_;
+    std::unique_lock<std::mutex> lock(state_->mtx);
+
+    Waiter waiter;
+    state_->waiters.push_back(&waiter);
+    ++state_->num_waiters;
+
+    // Must be called while holding the mutex.
+    const auto leave_queue = [&]() {
+      state_->waiters.erase(std::find(state_->waiters.begin(),
+                                      state_->waiters.end(), &waiter));
+      --state_->num_waiters;
+      if (!state_->waiters.empty()) {
+        state_->waiters.front()->cv.notify_one();
+      }
+    };
+
+    while (waiter.slot == NO_SLOT) {
+      if (state_->waiters.front() == &waiter) {
+        // A connection might have been released before we were registered
+        // as a waiter.
+        const auto ix = claim(state_.get());
+        if (ix != NO_SLOT) {
+          leave_queue();
+          return make_session(ix, _start);
+        }
+
+        if (state_->num_open < state_->max_size) {
+          leave_queue();
+          const auto ix = state_->empty_slots.back();
+          state_->empty_slots.pop_back();
+          ++state_->num_open;
+          lock.unlock();
+          return open_connection(ix, _start);
+        }
+      }
+
+      if (waiter.cv.wait_until(lock, deadline) == std::cv_status::timeout &&
+          waiter.slot == NO_SLOT) {
+        leave_queue();
+        if (!_wait) {
+          return error("No connection is available in the pool right now.");
+        }
+        ++state_->num_timeouts;
+        return error("No connection became available in the pool within " +
+                     std::to_string(state_->timeout.count()) + "ms.");
+      }
+    }
+
+    // The slot has been handed to us by release(...), which has also removed
+    // us from the queue.
+    return make_session(waiter.slot, _start);
+  }
+
+  /// Opens a new connection in a slot that has already been counted in
+  /// num_open. Must be called without holding the mutex.
+  Result<Ref<Session<Connection>>> open_connection(
+      const uint32_t _ix, const Clock::time_point _start) {
+    try {
+      state_->slots[_ix].conn = state_->make_conn();
+      return make_session(_ix, _start);
+    } catch (std::exception& e) {
+      std::lock_guard<std::mutex> lock(state_->mtx);
+      state_->empty_slots.push_back(_ix);
+      --state_->num_open;
+      if (!state_->waiters.empty()) {
+        state_->waiters.front()->cv.notify_one();
+      }
+      return error(e.what());
+    }
+  }
+
+  /// Creates a session for a slot owned by the calling thread. _start is
+  /// when the calling thread entered acquire().
+  Ref<Session<Connection>> make_session(const uint32_t _ix,
+                                        const Clock::time_point _start) const {
+    last_slot() = std::make_pair(state_->id, _ix);
+
+    const auto now = Clock::now();
+    state_->slots[_ix].acquired_at = now;
+    state_->wait_time.record(now - _start);
+    const auto in_use = ++state_->num_in_use;
+    auto peak = state_->peak_in_use.load();
+    while (peak < in_use &&
+           !state_->peak_in_use.compare_exchange_weak(peak, in_use)) {
+    }
+
+    return Ref<Session<Connection>>::make(
+        *state_->slots[_ix].conn,
+        [state = state_, _ix](const ConnPtr&) { release(state, _ix); });
+  }
+
+  /// The id of the pool the calling thread has used last and the slot it
+  /// has used in that pool.
+  static std::pair<uint64_t, uint32_t>& last_slot() {
+    thread_local std::pair<uint64_t, uint32_t> last_slot =
+        std::make_pair(uint64_t(0), NO_SLOT);
+    return last_slot;
+  }
+
+  static uint64_t make_id() {
+    static std::atomic<uint64_t> num_pools = 0;
+    return ++num_pools;
+  }
+
+  /// Claims an idle slot without taking the mutex. Returns NO_SLOT, if there
+  /// is none.
+  static uint32_t claim(State* _state) {
+    const auto [id, ix] = last_slot();
+    if (id == _state->id && try_claim(_state, ix)) {
+      return ix;
+    }
+    while (true) {
+      const auto ix = pop(_state);
+      if (ix == NO_SLOT) {
+        return NO_SLOT;
+      }
+      _state->slots[ix].on_free_list = false;
+      if (try_claim(_state, ix)) {
+        return ix;
+      }
+    }
+  }
+
+  static bool try_claim(State* _state, const uint32_t _ix) {
+    bool idle = true;
+    return _state->slots[_ix].idle.compare_exchange_strong(idle, false);
+  }
+
+  /// Called when a session is destroyed.
+  static void release(const Ref<State>& _state, const uint32_t _ix) {
+    const auto now = Clock::now();
+    _state->hold_time.record(now - _state->slots[_ix].acquired_at);
+    --_state->num_in_use;
+    make_idle(_state, _ix, now);
+  }
+
+  /// Hands the connection to the first waiting thread or marks it as idle.
+  static void make_idle(const Ref<State>& _state, const uint32_t _ix,
+                        const Clock::time_point _now = Clock::now()) {
+    auto& slot = _state->slots[_ix];
+    slot.released_at = _now.time_since_epoch().count();
+    slot.idle = true;
+    if (!slot.on_free_list.exchange(true)) {
+      push(_state.get(), _ix);
+    }
+
+    // A waiting thread registers itself before it looks at the free list,
+    // and we look at num_waiters after having pushed the slot, so either the
+    // waiter finds the slot or we find the waiter.
+    if (_state->num_waiters == 0) {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(_state->mtx);
+    while (!_state->waiters.empty()) {
+      const auto ix = claim(_state.get());
+      if (ix == NO_SLOT) {
+        break;
+      }
+      const auto waiter = _state->waiters.front();
+      _state->waiters.pop_front();
+      --_state->num_waiters;
+      waiter->slot = ix;
+      // This must happen while holding the mutex, because the waiter is
+      // destroyed, as soon as its thread can return from acquire().
+      waiter->cv.notify_one();
+    }
+  }
 
-  /// The underlying connection objects.
-  Ref<std::vector<std::pair<ConnPtr, Ref<std::atomic_flag>>>> conns_;
+  static void push(State* _state, const uint32_t _ix) {
+    auto head = _state->free_list.load();
+    do {
+      _state->slots[_ix].next = static_cast<uint32_t>(head);
+    } while (!_state->free_list.compare_exchange_weak(
+        head, ((head >> 32) + 1) << 32 | _ix));
+  }
+
+  static uint32_t pop(State* _state) {
+    auto head = _state->free_list.load();
+    while (true) {
+      const auto ix = static_cast<uint32_t>(head);
+      if (ix == NO_SLOT) {
+        return NO_SLOT;
+      }
+      const uint64_t next = _state->slots[ix].next;
+      if (_state->free_list.compare_exchange_weak(
+              head, ((head >> 32) + 1) << 32 | next)) {
+        return ix;
+      }
+    }
+  }
+
+  /// Closes the connections beyond min_size that have been idle for longer
+  /// than idle_timeout. To keep acquire() cheap, this only looks at the
+  /// slots every quarter of the idle_timeout.
+  void remove_expired_if_due() {
+    const auto now = Clock::now();
+    auto next_check = state_->next_expiry_check.load();
+    if (now.time_since_epoch().count() < next_check ||
+        !state_->next_expiry_check.compare_exchange_strong(
+            next_check, (now + state_->idle_timeout / 4)
+                            .time_since_epoch()
+                            .count())) {
+      return;
+    }
+
+    // Declared before the lock, so they are closed after it is released.
+    std::vector<ConnPtr> expired;
+
+    std::lock_guard<std::mutex> lock(state_->mtx);
+    for (uint32_t i = 0; i < state_->max_size; ++i) {
+      if (state_->num_open <= state_->min_size) {
+        break;
+      }
+      auto& slot = state_->slots[i];
+      const auto released_at =
+          Clock::time_point(Clock::duration(slot.released_at.load()));
+      if (now - released_at >= state_->idle_timeout &&
+          try_claim(state_.get(), i)) {
+        expired.emplace_back(std::move(*slot.conn));
+        slot.conn.reset();
+        state_->empty_slots.push_back(i);
+        --state_->num_open;
+      }
+    }
+  }
+
+ private:
+  /// The state shared by all copies of the pool.
+  Ref<State> state_;
 };
 
 template <class Connection, class... Args>
@@ -0,0 +1,60 @@
+#ifndef SQLGEN_CONNECTIONPOOLMETRICS_HPP_
+#define SQLGEN_CONNECTIONPOOLMETRICS_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sqlgen {
+
+/// The distribution of a duration, as a list of buckets.
+struct Histogram {
+  /// The exclusive upper bounds of the buckets. The last bucket has no upper
+  /// bound and therefore no entry in here, so there is one bound less than
+  /// there are counts.
+  std::vector<std::chrono::microseconds> upper_bounds;
+
+  /// The number of durations in each bucket. These are not cumulative.
+  std::vector<uint64_t> counts;
+
+  /// The total number of durations.
+  uint64_t count = 0;
+
+  /// The sum of all durations.
+  std::chrono::microseconds sum = std::chrono::microseconds(0);
+};
+
+/// A snapshot of what a ConnectionPool has been doing since it was created.
+struct ConnectionPoolMetrics {
+  /// The number of connections that are open, whether they are in use or
+  /// not.
+  size_t size = 0;
+
+  /// The maximum number of connections.
+  size_t max_size = 0;
+
+  /// The number of sessions that are currently held.
+  size_t in_use = 0;
+
+  /// The largest number of sessions that have been held at the same time.
+  size_t peak_in_use = 0;
+
+  /// The number of threads that are currently waiting in acquire().
+  size_t num_waiting = 0;
+
+  /// The number of times acquire() gave up, because no connection became
+  /// available within the timeout.
+  uint64_t num_timeouts = 0;
+
+  /// How long acquire() took to hand out a session, including opening new
+  /// connections.
+  Histogram wait_time;
+
+  /// How long sessions were held, before they were released.
+  Histogram hold_time;
+};
+
+}  // namespace sqlgen
+
+#endif
@@ -1,21 +1,42 @@
 #ifndef SQLGEN_ITERATOR_HPP_
 #define SQLGEN_ITERATOR_HPP_
 
+#include <algorithm>
+#include <future>
 #include <iterator>
 #include <memory>
 #include <ranges>
+#include <vector>
 
 #include "Ref.hpp"
 #include "Result.hpp"
-#include "internal/batch_size.hpp"
-#include "internal/collect/vector.hpp"
+#include "internal/ReadOptions.hpp"
+#include "internal/RowBatch.hpp"
+#include "internal/ThreadPool.hpp"
 #include "internal/from_str_vec.hpp"
 
 namespace sqlgen {
 
 /// An input_iterator that returns the underlying type.
+///
+/// If prefetching is enabled in the ReadOptions, the next batch is fetched
+/// and parsed on a background thread while the current one is being
+/// consumed. The background thread holds its own reference to the underlying
+/// iterator, and therefore to the connection, and is always joined before the
+/// last copy of the iterator is destroyed. Nevertheless, the connection must
+/// not be used for anything else while a prefetching iterator is alive.
+///
+/// If more than one decode thread is requested, large batches are split into
+/// contiguous chunks of rows, which are parsed on the shared thread pool. The
+/// order of the rows and the errors of the individual rows are preserved.
 template <class T, class UnderlyingIteratorT>
 class Iterator {
+  using BatchType = Ref<std::vector<Result<T>>>;
+
+  /// Batches are only split, if every chunk gets at least this many rows.
+  /// Below that, handing the chunks to other threads costs more than it saves.
+  static constexpr size_t MIN_ROWS_PER_CHUNK = 1000;
+
  public:
   using difference_type = std::ptrdiff_t;
   using value_type = Result<T>;
@@ -26,8 +47,18 @@ class Iterator {
     bool operator!=(const Iterator& _it) const noexcept { return _it != *this; }
   };
 
-  Iterator(const Ref<UnderlyingIteratorT>& _it)
-      : current_batch_(get_next_batch(_it)), it_(_it), ix_(0) {}
+  Iterator(const Ref<UnderlyingIteratorT>& _it,
+           const internal::ReadOptions& _options = internal::ReadOptions{})
+      : current_batch_(
+            get_next_batch(_it, _options, first_batch_size(_options))),
+        it_(_it),
+        ix_(0),
+        options_(_options),
+        next_batch_size_(grow(first_batch_size(_options), _options)) {
+    if (options_.prefetch && !it_->end()) {
+      start_prefetch();
+    }
+  }
 
   ~Iterator() = default;
 
@@ -43,9 +74,24 @@ class Iterator {
 
   Iterator& operator++() noexcept {
     ++ix_;
-    if (ix_ >= current_batch_->size() && !it_->end()) {
-      current_batch_ = get_next_batch(it_);
+    if (ix_ < current_batch_->size()) {
+      return *this;
+    }
+    // it_ must not be touched while the background thread is working on it,
+    // so we have to wait for the prefetched batch before calling it_->end().
+    if (next_batch_.valid()) {
+      current_batch_ = next_batch_.get();
+      next_batch_ = std::shared_future<BatchType>();
+      ix_ = 0;
+      if (!it_->end()) {
+        start_prefetch();
+      }
+    } else if (!it_->end()) {
+      current_batch_ = get_next_batch(it_, options_, take_batch_size());
       ix_ = 0;
+      if (options_.prefetch && !it_->end()) {
+        start_prefetch();
+      }
     }
     return *this;
   }
@@ -53,26 +99,145 @@ class Iterator {
   void operator++(int) noexcept { ++*this; }
 
  private:
-  static Ref<std::vector<Result<T>>> get_next_batch(
-      const Ref<UnderlyingIteratorT>& _it) noexcept {
-    using namespace std::ranges::views;
-    return _it->next(SQLGEN_BATCH_SIZE)
-        .transform([](auto str_vec) {
-          return Ref<std::vector<Result<T>>>::make(internal::collect::vector(
-              str_vec | transform(internal::from_str_vec<T>)));
+  static BatchType get_next_batch(const Ref<UnderlyingIteratorT>& _it,
+                                  const internal::ReadOptions& _options,
+                                  const size_t _batch_size) noexcept {
+    return _it->next(_batch_size, _options.batch_bytes)
+        .transform([&](const internal::RowBatch& _batch) {
+          return decode_batch(_batch, _options.decode_threads);
         })
-        .value_or(Ref<std::vector<Result<T>>>());
+        .value_or(BatchType());
+  }
+
+  static BatchType decode_batch(const internal::RowBatch& _batch,
+                                const size_t _decode_threads) {
+    // The pool is only created, once parallel decoding has been asked for
+    // and there are enough rows to make it worthwhile.
+    if (_decode_threads <= 1 || _batch.size() < 2 * MIN_ROWS_PER_CHUNK) {
+      auto vec = Ref<std::vector<Result<T>>>::make();
+      decode_rows(_batch, 0, _batch.size(), vec.get());
+      return vec;
+    }
+
+    auto& pool = internal::ThreadPool::instance();
+    const auto num_chunks =
+        std::min({_decode_threads, pool.size() + 1,
+                  _batch.size() / MIN_ROWS_PER_CHUNK});
+
+    const auto chunk_begin = [&](const size_t _i) {
+      return _i * _batch.size() / num_chunks;
+    };
+
+    // The first chunk is parsed on the calling thread, so it does not sit
+    // idle while the pool is busy.
+    using FuturesType = std::vector<std::future<std::vector<Result<T>>>>;
+    FuturesType futures;
+    futures.reserve(num_chunks - 1);
+
+    // The tasks refer to _batch, so we must not return before all of them
+    // are done, not even when an exception is thrown.
+    struct WaitForAll {
+      ~WaitForAll() {
+        for (auto& fut : *futures_) {
+          if (fut.valid()) {
+            fut.wait();
+          }
+        }
+      }
+      FuturesType* futures_;
+    } wait_for_all{&futures};
+
+    try {
+      for (size_t i = 1; i < num_chunks; ++i) {
+        futures.emplace_back(pool.submit([&, i]() {
+          std::vector<Result<T>> chunk;
+          decode_rows(_batch, chunk_begin(i), chunk_begin(i + 1), &chunk);
+          return chunk;
+        }));
+      }
+    } catch (...) {
+      // Whatever could not be submitted is parsed on the calling thread below.
+    }
+
+    auto vec = Ref<std::vector<Result<T>>>::make();
+    vec->reserve(_batch.size());
+    decode_rows(_batch, 0, chunk_begin(1), vec.get());
+    for (auto& fut : futures) {
+      for (auto& res : fut.get()) {
+        vec->emplace_back(std::move(res));
+      }
+    }
+    decode_rows(_batch, chunk_begin(futures.size() + 1), _batch.size(),
+                vec.get());
+    return vec;
+  }
+
+  static void decode_rows(const internal::RowBatch& _batch,
+                          const size_t _begin, const size_t _end,
+                          std::vector<Result<T>>* _vec) {
+    _vec->reserve(_vec->size() + _end - _begin);
+    for (size_t i = _begin; i < _end; ++i) {
+      _vec->emplace_back(internal::from_str_vec<T>(_batch[i]));
+    }
+  }
+
+  /// The number of rows in the first batch.
+  static size_t first_batch_size(const internal::ReadOptions& _options) {
+    return _options.initial_batch_size == 0
+               ? _options.batch_size
+               : std::min(_options.initial_batch_size, _options.batch_size);
+  }
+
+  /// The number of rows in the batch following one of _batch_size rows.
+  static size_t grow(const size_t _batch_size,
+                     const internal::ReadOptions& _options) {
+    return _batch_size >= _options.batch_size / _options.batch_growth
+               ? _options.batch_size
+               : _batch_size * _options.batch_growth;
+  }
+
+  /// Returns the number of rows in the next batch and grows the batches.
+  size_t take_batch_size() noexcept {
+    const auto batch_size = next_batch_size_;
+    next_batch_size_ = grow(next_batch_size_, options_);
+    return batch_size;
+  }
+
+  /// Fetches the next batch on a background thread. If no thread can be
+  /// started, the next batch will simply be fetched synchronously.
+  void start_prefetch() noexcept {
+    const auto batch_size = take_batch_size();
+    try {
+      next_batch_ = std::async(std::launch::async,
+                               [it = it_, options = options_, batch_size]() {
+                                 return get_next_batch(it, options, batch_size);
+                               })
+                        .share();
+    } catch (...) {
+      next_batch_ = std::shared_future<BatchType>();
+    }
   }
 
  private:
   /// The current batch of data.
-  Ref<std::vector<Result<T>>> current_batch_;
+  BatchType current_batch_;
 
   /// The underlying database iterator.
   Ref<UnderlyingIteratorT> it_;
 
   /// The current index in the current batch.
   size_t ix_;
+
+  /// The batch that is being prefetched, if any. The last copy of a future
+  /// returned by std::async blocks on destruction, which guarantees that the
+  /// background thread is done before the iterator is gone.
+  std::shared_future<BatchType> next_batch_;
+
+  /// Controls how the results are fetched.
+  internal::ReadOptions options_;
+
+  /// The number of rows to fetch in the next batch.
+  size_t next_batch_size_;
 };
 
 }  // namespace sqlgen
@@ -0,0 +1,199 @@
+#ifndef SQLGEN_ROUTINGPOOL_HPP_
+#define SQLGEN_ROUTINGPOOL_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "ConnectionPool.hpp"
+#include "Ref.hpp"
+#include "Result.hpp"
+#include "RoutingSession.hpp"
+#include "Session.hpp"
+
+namespace sqlgen {
+
+struct RoutingPoolConfig {
+  /// How reads are spread over the replicas.
+  enum class Balancing {
+    /// Every replica gets the next read in turn.
+    round_robin,
+
+    /// Reads go to the replica with the fewest sessions currently reading
+    /// from it, which favours the replicas that answer quickly.
+    least_outstanding
+  };
+
+  Balancing balancing = Balancing::round_robin;
+
+  /// After a write has been sent to the primary, all reads are sent to the
+  /// primary for this long, so that they see the write, even if the replicas
+  /// have not caught up yet. 0 means reads always go to the replicas.
+  std::chrono::milliseconds pin_to_primary_after_write =
+      std::chrono::milliseconds(0);
+};
+
+/// Routes the work of a session to a pool of connections to the primary or
+/// to one of the pools of connections to its read replicas. Reads go to the
+/// replicas, writes, other statements and transactions go to the primary.
+/// Copies of the pool share the same connections.
+template <class Connection>
+class RoutingPool {
+  using Clock = std::chrono::steady_clock;
+
+  using SessionPtr = Ref<Session<Connection>>;
+
+  friend class RoutingSession<Connection>;
+
+  struct State {
+    ConnectionPool<Connection> primary;
+
+    std::vector<ConnectionPool<Connection>> replicas;
+
+    RoutingPoolConfig config;
+
+    /// The number of sessions reading from each of the replicas.
+    std::unique_ptr<std::atomic<size_t>[]> num_outstanding;
+
+    /// The number of replicas that have been picked so far.
+    std::atomic<size_t> num_picked = 0;
+
+    /// Reads go to the primary until this point in time, as a
+    /// Clock::duration::rep.
+    std::atomic<Clock::rep> pinned_until = 0;
+  };
+
+ public:
+  RoutingPool(const ConnectionPool<Connection>& _primary,
+              const std::vector<ConnectionPool<Connection>>& _replicas,
+              const RoutingPoolConfig& _config = RoutingPoolConfig{})
+      : state_(Ref<State>::make(_primary, _replicas, _config)) {
+    state_->num_outstanding =
+        std::make_unique<std::atomic<size_t>[]>(_replicas.size());
+  }
+
+  ~RoutingPool() = default;
+
+  /// Acquire a session from the pool. The underlying sessions on the primary
+  /// and the replicas are only acquired once they are needed, so this never
+  /// fails.
+  Result<Ref<RoutingSession<Connection>>> acquire() noexcept {
+    return Ref<RoutingSession<Connection>>::make(*this);
+  }
+
+  /// The pool of connections to the primary.
+  const ConnectionPool<Connection>& primary() const { return state_->primary; }
+
+  /// The pools of connections to the replicas.
+  const std::vector<ConnectionPool<Connection>>& replicas() const {
+    return state_->replicas;
+  }
+
+ private:
+  Result<SessionPtr> acquire_primary() noexcept {
+    return state_->primary.acquire();
+  }
+
+  /// Picks a replica and acquires a session from it. Returns the index of the
+  /// replica along with the session. Replicas are never waited for: If the
+  /// one picked cannot hand out a connection right away, because all of its
+  /// connections are in use or it cannot be reached, the others are tried in
+  /// turn, so that a busy or dead replica does not hold up the read.
+  Result<std::pair<size_t, SessionPtr>> acquire_replica() noexcept {
+    const auto num_replicas = state_->replicas.size();
+    if (num_replicas == 0) {
+      return error("There are no replicas.");
+    }
+    const auto first = pick_replica();
+    for (size_t i = 0; i < num_replicas; ++i) {
+      const auto ix = (first + i) % num_replicas;
+      ++state_->num_outstanding[ix];
+      const auto session = state_->replicas[ix].try_acquire();
+      if (session) {
+        return std::make_pair(ix, session.value());
+      }
+      --state_->num_outstanding[ix];
+    }
+    return error("None of the replicas can hand out a connection right now.");
+  }
+
+  size_t pick_replica() {
+    const auto num_replicas = state_->replicas.size();
+    const auto start = state_->num_picked++ % num_replicas;
+    if (state_->config.balancing ==
+        RoutingPoolConfig::Balancing::round_robin) {
+      return start;
+    }
+    // We start looking at a different replica every time, so that ties are
+    // broken in a round-robin fashion.
+    auto best = start;
+    for (size_t i = 1; i < num_replicas; ++i) {
+      const auto ix = (start + i) % num_replicas;
+      if (state_->num_outstanding[ix] < state_->num_outstanding[best]) {
+        best = ix;
+      }
+    }
+    return best;
+  }
+
+  void release_replica(const size_t _ix) noexcept {
+    --state_->num_outstanding[_ix];
+  }
+
+  /// Called whenever data has been written to the primary.
+  void mark_write() noexcept {
+    const auto window = state_->config.pin_to_primary_after_write;
+    if (window.count() == 0) {
+      return;
+    }
+    const auto until = (Clock::now() + window).time_since_epoch().count();
+    auto current = state_->pinned_until.load();
+    while (current < until &&
+           !state_->pinned_until.compare_exchange_weak(current, until)) {
+    }
+  }
+
+  bool reads_pinned_to_primary() const noexcept {
+    return Clock::now().time_since_epoch().count() < state_->pinned_until;
+  }
+
+ private:
+  /// The state shared by all copies of the pool.
+  Ref<State> state_;
+};
+
+template <class Connection>
+Result<RoutingPool<Connection>> make_routing_pool(
+    const Result<ConnectionPool<Connection>>& _primary,
+    const std::vector<Result<ConnectionPool<Connection>>>& _replicas,
+    const RoutingPoolConfig& _config = RoutingPoolConfig{}) noexcept {
+  return _primary.and_then(
+      [&](const auto& _p) -> Result<RoutingPool<Connection>> {
+        auto replicas = std::vector<ConnectionPool<Connection>>();
+        for (const auto& r : _replicas) {
+          if (!r) {
+            return error(r.error().what());
+          }
+          replicas.push_back(r.value());
+        }
+        return RoutingPool<Connection>(_p, replicas, _config);
+      });
+}
+
+template <class Connection>
+Result<Ref<RoutingSession<Connection>>> session(
+    RoutingPool<Connection> _pool) noexcept {
+  return _pool.acquire();
+}
+
+template <class Connection>
+Result<Ref<RoutingSession<Connection>>> session(
+    Result<RoutingPool<Connection>> _res) noexcept {
+  return _res.and_then([](auto _pool) { return session(_pool); });
+}
+
+}  // namespace sqlgen
+
+#endif
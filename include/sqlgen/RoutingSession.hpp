@@ -0,0 +1,223 @@
+#ifndef SQLGEN_ROUTINGSESSION_HPP_
+#define SQLGEN_ROUTINGSESSION_HPP_
+
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "Ref.hpp"
+#include "Result.hpp"
+#include "Session.hpp"
+#include "dynamic/Insert.hpp"
+#include "dynamic/SelectFrom.hpp"
+#include "dynamic/Statement.hpp"
+#include "dynamic/Write.hpp"
+#include "internal/ReadOptions.hpp"
+#include "internal/WriteOptions.hpp"
+
+namespace sqlgen {
+
+template <class Connection>
+class RoutingPool;
+
+/// A session acquired from a RoutingPool. Reads are sent to a session on one
+/// of the replicas, everything else is sent to a session on the primary.
+/// Reads are also sent to the primary inside of a transaction and while the
+/// pool pins them there after a write. The sessions are only acquired when
+/// they are first needed, so a session that only reads never touches the
+/// primary.
+template <class Connection>
+class RoutingSession {
+ public:
+  using ConnType = Connection;
+
+  RoutingSession(const RoutingPool<Connection>& _pool)
+      : pool_(_pool), replica_ix_(0), in_transaction_(false) {}
+
+  RoutingSession(const RoutingSession<Connection>& _other) = delete;
+
+  ~RoutingSession() {
+    if (replica_) {
+      replica_.reset();
+      pool_.release_replica(replica_ix_);
+    }
+  }
+
+  Result<Nothing> begin_transaction() {
+    return primary()
+        .and_then([](const auto& _s) { return _s->begin_transaction(); })
+        .transform([&](const auto& _nothing) {
+          in_transaction_ = true;
+          return _nothing;
+        });
+  }
+
+  Result<Nothing> commit() {
+    return primary()
+        .and_then([](const auto& _s) { return _s->commit(); })
+        .transform([&](const auto& _nothing) {
+          in_transaction_ = false;
+          pool_.mark_write();
+          return _nothing;
+        });
+  }
+
+  Result<Nothing> execute(const std::string& _sql) {
+    return primary()
+        .and_then([&](const auto& _s) { return _s->execute(_sql); })
+        .transform(mark_write());
+  }
+
+  template <class ItBegin, class ItEnd>
+  Result<Nothing> insert(
+      const dynamic::Insert& _stmt, ItBegin _begin, ItEnd _end,
+      const internal::WriteOptions& _options = internal::WriteOptions{}) {
+    return primary()
+        .and_then([&](const auto& _s) {
+          return _s->insert(_stmt, _begin, _end, _options);
+        })
+        .transform(mark_write());
+  }
+
+  template <class ItBegin, class ItEnd>
+  Result<Nothing> insert(
+      const std::string& _sql, ItBegin _begin, ItEnd _end,
+      const internal::WriteOptions& _options = internal::WriteOptions{}) {
+    return primary()
+        .and_then([&](const auto& _s) {
+          return _s->insert(_sql, _begin, _end, _options);
+        })
+        .transform(mark_write());
+  }
+
+  /// Only exists, if the underlying connection can announce writes to other
+  /// processes.
+  Result<Nothing> notify_invalidation(const std::string& _table)
+    requires requires(Connection& _c, const std::string& _t) {
+      _c.notify_invalidation(_t);
+    }
+  {
+    return primary().and_then(
+        [&](const auto& _s) { return _s->notify_invalidation(_table); });
+  }
+
+  RoutingSession& operator=(const RoutingSession& _other) = delete;
+
+  template <class ContainerType>
+  Result<ContainerType> read(
+      const dynamic::SelectFrom& _query,
+      const internal::ReadOptions& _options = internal::ReadOptions{}) {
+    return reader().and_then([&](const auto& _s) {
+      return _s->template read<ContainerType>(_query, _options);
+    });
+  }
+
+  template <class ContainerType>
+  Result<ContainerType> read(
+      const std::string& _sql,
+      const internal::ReadOptions& _options = internal::ReadOptions{}) {
+    return reader().and_then([&](const auto& _s) {
+      return _s->template read<ContainerType>(_sql, _options);
+    });
+  }
+
+  Result<Nothing> rollback() noexcept {
+    return primary()
+        .and_then([](const auto& _s) { return _s->rollback(); })
+        .transform([&](const auto& _nothing) {
+          in_transaction_ = false;
+          return _nothing;
+        });
+  }
+
+  static std::string to_sql(const dynamic::Statement& _stmt) noexcept {
+    return Connection::to_sql(_stmt);
+  }
+
+  Result<Nothing> start_write(const dynamic::Write& _stmt) {
+    return primary().and_then(
+        [&](const auto& _s) { return _s->start_write(_stmt); });
+  }
+
+  Result<Nothing> start_write(const std::string& _sql) {
+    return primary().and_then(
+        [&](const auto& _s) { return _s->start_write(_sql); });
+  }
+
+  Result<Nothing> end_write() {
+    return primary()
+        .and_then([](const auto& _s) { return _s->end_write(); })
+        .transform(mark_write());
+  }
+
+  template <class ItBegin, class ItEnd>
+  Result<Nothing> write(
+      ItBegin _begin, ItEnd _end,
+      const internal::WriteOptions& _options = internal::WriteOptions{}) {
+    return primary()
+        .and_then([&](const auto& _s) {
+          return _s->write(_begin, _end, _options);
+        })
+        .transform(mark_write());
+  }
+
+ private:
+  /// Returns a function that tells the pool that data has been written and
+  /// passes its argument through.
+  auto mark_write() {
+    return [this](const auto& _nothing) {
+      pool_.mark_write();
+      return _nothing;
+    };
+  }
+
+  /// Returns the session on the primary, acquiring it if necessary.
+  Result<Ref<Session<Connection>>> primary() {
+    if (primary_) {
+      return *primary_;
+    }
+    return pool_.acquire_primary().transform([&](const auto& _s) {
+      primary_ = _s;
+      return _s;
+    });
+  }
+
+  /// Returns the session reads should be sent to.
+  Result<Ref<Session<Connection>>> reader() {
+    if (in_transaction_ || pool_.reads_pinned_to_primary()) {
+      return primary();
+    }
+    if (replica_) {
+      return *replica_;
+    }
+    const auto replica = pool_.acquire_replica();
+    if (!replica) {
+      // If there are no replicas or none of them can hand out a connection
+      // right away, the primary has to do the work.
+      return primary();
+    }
+    replica_ix_ = replica->first;
+    replica_ = replica->second;
+    return *replica_;
+  }
+
+ private:
+  /// The pool this session belongs to.
+  RoutingPool<Connection> pool_;
+
+  /// The session on the primary, once it has been acquired.
+  std::optional<Ref<Session<Connection>>> primary_;
+
+  /// The session on one of the replicas, once it has been acquired.
+  std::optional<Ref<Session<Connection>>> replica_;
+
+  /// The index of the replica replica_ has been acquired from.
+  size_t replica_ix_;
+
+  /// Whether a transaction has been begun on the primary and not yet ended.
+  bool in_transaction_;
+};
+
+}  // namespace sqlgen
+
+#endif
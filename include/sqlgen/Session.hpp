@@ -1,9 +1,10 @@
 #ifndef SQLGEN_SESSION_HPP_
 #define SQLGEN_SESSION_HPP_
 
-#include <atomic>
+#include <functional>
 #include <memory>
 #include <optional>
+#include <string>
 #include <vector>
 
 #include "Ref.hpp"
@@ -12,27 +13,33 @@
 #include "dynamic/SelectFrom.hpp"
 #include "dynamic/Statement.hpp"
 #include "dynamic/Write.hpp"
+#include "internal/ReadOptions.hpp"
+#include "internal/WriteOptions.hpp"
 
 namespace sqlgen {
 
 template <class Connection>
 class Session {
  public:
+  using ConnType = Connection;
   using ConnPtr = Ref<Connection>;
 
-  Session(const Ref<Connection>& _conn, const Ref<std::atomic_flag>& _flag)
-      : conn_(_conn), flag_(_flag.ptr()) {}
+  /// Called with the connection, when the session is destroyed.
+  using ReleaseFunction = std::function<void(const Ref<Connection>&)>;
+
+  Session(const Ref<Connection>& _conn, const ReleaseFunction& _release)
+      : conn_(_conn), release_(_release) {}
 
   Session(const Session<Connection>& _other) = delete;
 
   Session(Session<Connection>&& _other)
-      : conn_(std::move(_other.conn_)), flag_(_other.flag_) {
-    _other.flag_.reset();
+      : conn_(_other.conn_), release_(std::move(_other.release_)) {
+    _other.release_ = nullptr;
   }
 
   ~Session() {
-    if (flag_) {
-      flag_->clear();
+    if (release_) {
+      release_(conn_);
     }
   }
 
@@ -45,9 +52,27 @@ class Session {
   }
 
   template <class ItBegin, class ItEnd>
-  Result<Nothing> insert(const dynamic::Insert& _stmt, ItBegin _begin,
-                         ItEnd _end) {
-    return conn_->insert(_stmt, _begin, _end);
+  Result<Nothing> insert(
+      const dynamic::Insert& _stmt, ItBegin _begin, ItEnd _end,
+      const internal::WriteOptions& _options = internal::WriteOptions{}) {
+    return conn_->insert(_stmt, _begin, _end, _options);
+  }
+
+  template <class ItBegin, class ItEnd>
+  Result<Nothing> insert(
+      const std::string& _sql, ItBegin _begin, ItEnd _end,
+      const internal::WriteOptions& _options = internal::WriteOptions{}) {
+    return conn_->insert(_sql, _begin, _end, _options);
+  }
+
+  /// Only exists, if the underlying connection can announce writes to other
+  /// processes.
+  Result<Nothing> notify_invalidation(const std::string& _table)
+    requires requires(Connection& _c, const std::string& _t) {
+      _c.notify_invalidation(_t);
+    }
+  {
+    return conn_->notify_invalidation(_table);
   }
 
   Session& operator=(const Session& _other) = delete;
@@ -56,41 +81,59 @@ class Session {
     if (this == &_other) {
       return *this;
     }
-    conn_ = std::move(_other.conn_);
-    flag_ = _other.flag_;
-    _other.flag_.reset();
+    if (release_) {
+      release_(conn_);
+    }
+    conn_ = _other.conn_;
+    release_ = std::move(_other.release_);
+    _other.release_ = nullptr;
     return *this;
   }
 
   template <class ContainerType>
-  Result<ContainerType> read(const dynamic::SelectFrom& _query) {
-    return conn_->template read<ContainerType>(_query);
+  Result<ContainerType> read(
+      const dynamic::SelectFrom& _query,
+      const internal::ReadOptions& _options = internal::ReadOptions{}) {
+    return conn_->template read<ContainerType>(_query, _options);
+  }
+
+  template <class ContainerType>
+  Result<ContainerType> read(
+      const std::string& _sql,
+      const internal::ReadOptions& _options = internal::ReadOptions{}) {
+    return conn_->template read<ContainerType>(_sql, _options);
   }
 
   Result<Nothing> rollback() noexcept { return conn_->rollback(); }
 
-  std::string to_sql(const dynamic::Statement& _stmt) noexcept {
-    return conn_->to_sql(_stmt);
+  static std::string to_sql(const dynamic::Statement& _stmt) noexcept {
+    return Connection::to_sql(_stmt);
   }
 
   Result<Nothing> start_write(const dynamic::Write& _stmt) {
     return conn_->start_write(_stmt);
   }
 
+  Result<Nothing> start_write(const std::string& _sql) {
+    return conn_->start_write(_sql);
+  }
+
   Result<Nothing> end_write() { return conn_->end_write(); }
 
   template <class ItBegin, class ItEnd>
-  Result<Nothing> write(ItBegin _begin, ItEnd _end) {
-    return conn_->write(_begin, _end);
+  Result<Nothing> write(
+      ItBegin _begin, ItEnd _end,
+      const internal::WriteOptions& _options = internal::WriteOptions{}) {
+    return conn_->write(_begin, _end, _options);
   }
 
  private:
   /// The underlying connection object.
   ConnPtr conn_;
 
-  /// The flag corresponding to the object - as long as this is true, we have
+  /// Returns the connection to the pool - as long as this is set, we have
   /// ownership.
-  std::shared_ptr<std::atomic_flag> flag_;
+  ReleaseFunction release_;
 };
 
 }  // namespace sqlgen
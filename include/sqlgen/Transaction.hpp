@@ -1,7 +1,15 @@
 #ifndef SQLGEN_TRANSACTION_HPP_
 #define SQLGEN_TRANSACTION_HPP_
 
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "Ref.hpp"
+#include "internal/ReadOptions.hpp"
+#include "internal/TableVersions.hpp"
+#include "internal/WriteOptions.hpp"
 #include "is_connection.hpp"
 
 namespace sqlgen {
@@ -19,7 +27,8 @@ class Transaction {
 
   Transaction(Transaction&& _other) noexcept
       : conn_(std::move(_other.conn_)),
-        transaction_ended_(_other.transaction_ended_) {
+        transaction_ended_(_other.transaction_ended_),
+        tables_to_invalidate_(std::move(_other.tables_to_invalidate_)) {
     _other.transaction_ended_ = true;
   }
 
@@ -43,10 +52,14 @@ class Transaction {
     if (transaction_ended_) {
       return error("Transaction has already ended, cannot commit.");
     }
-    return conn_->commit().transform([&](const auto& _nothing) {
+    // If the commit fails, the writes may or may not have been applied, so
+    // the cached results are invalidated either way.
+    auto res = conn_->commit().transform([&](const auto& _nothing) {
       transaction_ended_ = true;
       return _nothing;
     });
+    invalidate_tables();
+    return res;
   }
 
   const Ref<ConnType>& conn() const noexcept { return conn_; }
@@ -56,9 +69,37 @@ class Transaction {
   }
 
   template <class ItBegin, class ItEnd>
-  Result<Nothing> insert(const dynamic::Insert& _stmt, ItBegin _begin,
-                         ItEnd _end) {
-    return conn_->insert(_stmt, _begin, _end);
+  Result<Nothing> insert(
+      const dynamic::Insert& _stmt, ItBegin _begin, ItEnd _end,
+      const internal::WriteOptions& _options = internal::WriteOptions{}) {
+    return conn_->insert(_stmt, _begin, _end, _options);
+  }
+
+  template <class ItBegin, class ItEnd>
+  Result<Nothing> insert(
+      const std::string& _sql, ItBegin _begin, ItEnd _end,
+      const internal::WriteOptions& _options = internal::WriteOptions{}) {
+    return conn_->insert(_sql, _begin, _end, _options);
+  }
+
+  /// Only exists, if the underlying connection can announce writes to other
+  /// processes.
+  Result<Nothing> notify_invalidation(const std::string& _table)
+    requires requires(ConnType& _c, const std::string& _t) {
+      _c.notify_invalidation(_t);
+    }
+  {
+    return conn_->notify_invalidation(_table);
+  }
+
+  /// Remembers that _table has been written to, so that the cached results
+  /// read from it can be invalidated once more, when the write becomes
+  /// visible to other connections.
+  void invalidate_on_commit(const std::string& _table) {
+    if (std::find(tables_to_invalidate_.begin(), tables_to_invalidate_.end(),
+                  _table) == tables_to_invalidate_.end()) {
+      tables_to_invalidate_.push_back(_table);
+    }
   }
 
   Transaction& operator=(const Transaction& _other) = delete;
@@ -69,44 +110,77 @@ class Transaction {
     }
     conn_ = _other.conn_;
     transaction_ended_ = _other.transaction_ended_;
+    tables_to_invalidate_ = std::move(_other.tables_to_invalidate_);
     _other.transaction_ended_ = true;
     return *this;
   }
 
   template <class ContainerType>
-  Result<ContainerType> read(const dynamic::SelectFrom& _query) {
-    return conn_->template read<ContainerType>(_query);
+  Result<ContainerType> read(
+      const dynamic::SelectFrom& _query,
+      const internal::ReadOptions& _options = internal::ReadOptions{}) {
+    return conn_->template read<ContainerType>(_query, _options);
+  }
+
+  template <class ContainerType>
+  Result<ContainerType> read(
+      const std::string& _sql,
+      const internal::ReadOptions& _options = internal::ReadOptions{}) {
+    return conn_->template read<ContainerType>(_sql, _options);
   }
 
   Result<Nothing> rollback() noexcept {
     if (transaction_ended_) {
       return error("Transaction has already ended, cannot roll back.");
     }
-    return conn_->rollback().transform([&](const auto& _nothing) {
+    // Results read through the transaction may have been cached and contain
+    // writes that are now undone, whether or not the rollback succeeds.
+    auto res = conn_->rollback().transform([&](const auto& _nothing) {
       transaction_ended_ = true;
       return _nothing;
     });
+    invalidate_tables();
+    return res;
   }
 
-  std::string to_sql(const dynamic::Statement& _stmt) noexcept {
-    return conn_->to_sql(_stmt);
+  static std::string to_sql(const dynamic::Statement& _stmt) noexcept {
+    return ConnType::to_sql(_stmt);
   }
 
   Result<Nothing> start_write(const dynamic::Write& _stmt) {
     return conn_->start_write(_stmt);
   }
 
+  Result<Nothing> start_write(const std::string& _sql) {
+    return conn_->start_write(_sql);
+  }
+
   Result<Nothing> end_write() { return conn_->end_write(); }
 
   template <class ItBegin, class ItEnd>
-  Result<Nothing> write(ItBegin _begin, ItEnd _end) {
-    return conn_->write(_begin, _end);
+  Result<Nothing> write(
+      ItBegin _begin, ItEnd _end,
+      const internal::WriteOptions& _options = internal::WriteOptions{}) {
+    return conn_->write(_begin, _end, _options);
+  }
+
+ private:
+  /// Marks the cached results read from the tables written to during the
+  /// transaction as stale.
+  void invalidate_tables() noexcept {
+    for (const auto& table : tables_to_invalidate_) {
+      internal::TableVersions::instance().bump(table);
+    }
+    tables_to_invalidate_.clear();
   }
 
  private:
   Ref<ConnType> conn_;
 
   bool transaction_ended_;
+
+  /// The tables that have been written to during the transaction.
+  std::vector<std::string> tables_to_invalidate_;
 };
 
 }  // namespace sqlgen
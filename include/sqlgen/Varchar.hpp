@@ -3,6 +3,7 @@
 
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 #include "Result.hpp"
 
@@ -19,6 +20,8 @@ class Varchar {
 
   Varchar(const std::string& _value) : value_(check_size(_value)) {}
 
+  Varchar(std::string&& _value) : value_(check_size(std::move(_value))) {}
+
   Varchar(const char* _value) : value_(check_size(_value)) {}
 
   Varchar(Varchar<_size>&& _other) noexcept = default;
@@ -42,6 +45,14 @@ class Varchar {
     }
   }
 
+  static Result<Varchar<size_>> make(std::string&& _value) noexcept {
+    try {
+      return Varchar<size_>(std::move(_value));
+    } catch (std::exception& e) {
+      return error(e.what());
+    }
+  }
+
   /// Returns the underlying object.
   const ReflectionType& get() const { return value_; }
 
@@ -82,7 +93,9 @@ class Varchar {
   const std::string& value() const { return value_; }
 
  private:
-  static std::string check_size(const std::string& _str) {
+  /// Takes _str by value, so that strings passed as rvalues are moved
+  /// rather than copied.
+  static std::string check_size(std::string _str) {
     if (_str.size() > size_) {
       throw std::runtime_error(
           "String '" + _str + "' too long: " + std::to_string(_str.size()) +
@@ -0,0 +1,41 @@
+#ifndef SQLGEN_BATCH_SIZE_HPP_
+#define SQLGEN_BATCH_SIZE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+
+namespace sqlgen {
+
+struct BatchSize {
+  size_t val;
+};
+
+struct BatchBytes {
+  size_t val;
+};
+
+struct AdaptiveBatchSize {
+  size_t initial;
+  size_t growth;
+};
+
+/// Limits the number of rows read from or written to the database at once.
+inline auto batch_size(const size_t _val) {
+  return BatchSize{std::max(_val, size_t(1))};
+}
+
+/// Limits the size of the cells read from or written to the database at
+/// once. The last row of a batch may go over the limit.
+inline auto batch_bytes(const size_t _val) { return BatchBytes{_val}; }
+
+/// Starts with batches of _initial rows and multiplies the size of every
+/// batch by _growth, until the batch size is reached.
+inline auto adaptive_batch_size(const size_t _initial,
+                                const size_t _growth = 2) {
+  return AdaptiveBatchSize{std::max(_initial, size_t(1)),
+                           std::max(_growth, size_t(1))};
+}
+
+}  // namespace sqlgen
+
+#endif
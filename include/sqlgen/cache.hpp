@@ -1,89 +1,284 @@
 #ifndef SQLGEN_CACHE_HPP_
 #define SQLGEN_CACHE_HPP_
 
-#include <functional>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <future>
-#include <limits>
-#include <shared_mutex>
-#include <string>
+#include <memory>
 #include <type_traits>
-#include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "ConnectionPool.hpp"
 #include "Ref.hpp"
 #include "Result.hpp"
+#include "Session.hpp"
+#include "internal/CacheOptions.hpp"
+#include "internal/LRUCache.hpp"
+#include "internal/TableVersions.hpp"
+#include "internal/cache_executor.hpp"
+#include "internal/estimate_size.hpp"
+#include "internal/get_tables.hpp"
+#include "internal/hash_statement.hpp"
 #include "internal/query_value_t.hpp"
 #include "is_connection.hpp"
 #include "transpilation/to_sql.hpp"
 
 namespace sqlgen {
 
-template <class QueryT, class Connection, size_t _max_size>
+template <class QueryT, class Connection, size_t _max_size, size_t _max_bytes>
   requires is_connection<Connection>
 class CacheImpl {
-  static constexpr size_t max_size_ =
-      _max_size == 0 ? std::numeric_limits<size_t>::max() : _max_size;
-
  public:
   using ValueType = internal::query_value_t<QueryT, Ref<Connection>>;
 
+  using Clock = std::chrono::steady_clock;
+
+  /// A result, together with the versions of the tables it has been read
+  /// from.
+  struct Entry {
+    struct Dependency {
+      const internal::TableVersions::Counter* counter;
+      uint64_t version;
+    };
+
+    /// Whether none of the tables has been written to since the query was
+    /// started.
+    bool is_current() const noexcept {
+      return std::all_of(dependencies.begin(), dependencies.end(),
+                         [](const Dependency& _d) {
+                           return _d.counter->load(std::memory_order_acquire) ==
+                                  _d.version;
+                         });
+    }
+
+    /// Whether the query was started at least _max_age ago. Nothing is too
+    /// old, if _max_age is 0.
+    bool is_older_than(const Clock::duration _max_age,
+                       const Clock::time_point _now) const noexcept {
+      return _max_age != Clock::duration::zero() &&
+             _now - started_at >= _max_age;
+    }
+
+    std::shared_future<Result<ValueType>> future;
+
+    /// The encoded statement. Different statements may have the same hash,
+    /// so this is compared on every hit.
+    std::vector<uint64_t> words;
+
+    std::vector<Dependency> dependencies;
+
+    /// When the query was started.
+    Clock::time_point started_at;
+
+    /// Set while the result is being refreshed in the background, so that
+    /// only one refresh runs at a time.
+    std::atomic<bool> is_refreshing = false;
+  };
+
+  /// The entries are keyed by a hash of the transpiled statement, which is
+  /// much cheaper to compute than the SQL. The SQL only depends on the
+  /// statement and the dialect, and every connection type has a cache of its
+  /// own. An entry for a different statement with the same hash counts as a
+  /// miss and is replaced.
+  using CacheType = internal::LRUCache<internal::StatementHash, Ref<Entry>,
+                                       internal::StatementHash::Hasher>;
+
+  /// Concurrent misses for the same query share a single fetch: Only the
+  /// thread that inserts the future into the cache schedules the query, all
+  /// others wait for the future it has inserted. Entries that are no longer
+  /// current, because one of their tables has been written to through
+  /// sqlgen, or that are older than the ttl count as misses and are
+  /// replaced.
+  static Result<ValueType> fetch(const QueryT& _query,
+                                 const Ref<Connection>& _conn,
+                                 const internal::CacheOptions& _options) {
+    return fetch_impl<false>(
+        _query, [&_conn]() -> Result<Ref<Connection>> { return _conn; },
+        _options);
+  }
+
+  /// Like above, but entries older than the soft_ttl are still served and
+  /// refreshed in the background by the first caller that finds them. The
+  /// refresh runs on a session of its own, which is taken from _pool, so
+  /// that it does not depend on the caller's connection.
+  template <class ConnType>
+    requires std::is_same_v<Connection, Session<ConnType>>
   static Result<ValueType> fetch(const QueryT& _query,
-                                 const Ref<Connection>& _conn) {
-    const auto sql = _conn->to_sql(transpilation::to_sql(_query));
-
-    const auto try_read_from_cache =
-        [&]() -> Result<std::shared_future<Result<ValueType>>> {
-      std::shared_lock read_lock(mtx_);
-      const auto it = cache_.find(sql);
-      if (it != cache_.end()) {
-        return it->second.first;
+                                 const ConnectionPool<ConnType>& _pool,
+                                 const internal::CacheOptions& _options) {
+    return fetch_impl<true>(
+        _query, [pool = _pool]() { return session(pool); }, _options);
+  }
+
+  static const CacheType& cache() { return cache_; }
+
+ private:
+  template <bool _in_background, class GetConnT>
+  static Result<ValueType> fetch_impl(const QueryT& _query,
+                                      const GetConnT& _get_conn,
+                                      const internal::CacheOptions& _options) {
+    const auto stmt = transpilation::to_sql(_query);
+    auto encoded = internal::encode_statement(stmt);
+    const auto key = encoded.hash;
+    const auto now = Clock::now();
+
+    if (const auto entry = cache_.get(key);
+        entry && (*entry)->words == encoded.words &&
+        (*entry)->is_current() &&
+        !(*entry)->is_older_than(_options.ttl, now)) {
+      if constexpr (_in_background) {
+        if ((*entry)->is_older_than(_options.soft_ttl, now) &&
+            (*entry)->future.wait_for(std::chrono::seconds(0)) ==
+                std::future_status::ready &&
+            !(*entry)->is_refreshing.exchange(true)) {
+          refresh_in_background(_query, _get_conn, stmt, key, now, *entry);
+        }
       }
-      return error("Could not find the result for the query in the cache.");
-    };
+      return (*entry)->future.get();
+    }
 
-    const auto write_to_cache =
-        [&](const std::shared_future<Result<ValueType>>& _future) {
-          std::unique_lock write_lock(mtx_);
-          cache_[sql] = std::make_pair(_future, counter_++);
-          if (cache_.size() > max_size_) {
-            const auto it =
-                std::min_element(cache_.begin(), cache_.end(),
-                                 [](const auto& _p1, const auto& _p2) {
-                                   return _p1.second.second < _p2.second.second;
-                                 });
-            cache_.erase(it);
-          }
-        };
-
-    return try_read_from_cache()
-        .and_then([](auto _future) { return _future.get(); })
-        .or_else([&](auto&&) -> Result<ValueType> {
-          const std::shared_future<Result<ValueType>> future =
-              std::async(std::launch::async, [&]() { return _query(_conn); });
-          write_to_cache(future);
-          return future.get();
+    auto task = make_task(_query, _get_conn);
+
+    const auto new_entry = make_entry(stmt, std::move(encoded.words), now,
+                                      task->get_future().share());
+
+    const auto [entry, is_new] = cache_.get_or_replace_if(
+        key, new_entry, [&](const Ref<Entry>& _e) {
+          return _e->words != new_entry->words || !_e->is_current() ||
+                 _e->is_older_than(_options.ttl, now);
         });
+
+    if (is_new) {
+      internal::cache_executor().submit([task]() { (*task)(); });
+    }
+
+    const auto& res = entry->future.get();
+    if constexpr (_max_bytes != 0) {
+      if (is_new && res) {
+        cache_.set_num_bytes(key, internal::estimate_size(*res));
+      }
+    }
+    return res;
   }
 
-  static const auto& cache() { return cache_; }
+  static std::vector<typename Entry::Dependency> make_dependencies(
+      const dynamic::Statement& _stmt) {
+    auto& versions = internal::TableVersions::instance();
+    std::vector<typename Entry::Dependency> dependencies;
+    for (const auto& table : internal::get_tables(_stmt)) {
+      const auto counter = versions.counter(table);
+      dependencies.emplace_back(typename Entry::Dependency{
+          counter, counter->load(std::memory_order_acquire)});
+    }
+    return dependencies;
+  }
 
- private:
-  inline static size_t counter_ = 0;
+  /// The versions and the time are taken before the query is started, so
+  /// that writes which happen while it is running make the result stale.
+  static Ref<Entry> make_entry(
+      const dynamic::Statement& _stmt, std::vector<uint64_t>&& _words,
+      const Clock::time_point _started_at,
+      const std::shared_future<Result<ValueType>>& _future) {
+    auto entry = Ref<Entry>::make();
+    entry->future = _future;
+    entry->words = std::move(_words);
+    entry->dependencies = make_dependencies(_stmt);
+    entry->started_at = _started_at;
+    return entry;
+  }
+
+  /// _get_conn is copied into the task. On a miss, it references the
+  /// caller's connection, which outlives the task, because the caller waits
+  /// for it. A refresh in the background owns a pool instead, so it never
+  /// uses the caller's connection.
+  template <class GetConnT>
+  static auto make_task(const QueryT& _query, const GetConnT& _get_conn) {
+    return std::make_shared<std::packaged_task<Result<ValueType>()>>(
+        [query = _query, get_conn = _get_conn]() {
+          return get_conn().and_then(
+              [&](const auto& _conn) { return query(_conn); });
+        });
+  }
 
-  inline static std::unordered_map<
-      std::string, std::pair<std::shared_future<Result<ValueType>>, size_t>>
-      cache_;
+  /// Fetches a newer result for _old in the background and puts it into the
+  /// cache, unless _old has been replaced in the meantime. The caller does
+  /// not wait for it. If the query fails, _old is kept and served, and the
+  /// next call after the soft_ttl tries again.
+  template <class GetConnT>
+  static void refresh_in_background(const QueryT& _query,
+                                    const GetConnT& _get_conn,
+                                    const dynamic::Statement& _stmt,
+                                    const internal::StatementHash& _key,
+                                    const Clock::time_point _now,
+                                    const Ref<Entry>& _old) {
+    auto task = make_task(_query, _get_conn);
+    const auto entry = make_entry(_stmt, std::vector<uint64_t>(_old->words),
+                                  _now, task->get_future().share());
 
-  inline static std::shared_mutex mtx_;
+    internal::cache_executor().submit([task, entry, _key, _old]() {
+      (*task)();
+      try {
+        const auto& res = entry->future.get();
+        if (res) {
+          const auto is_replaceable = [&](const Ref<Entry>& _e) {
+            return _e.get() == _old.get() || !_e->is_current();
+          };
+          if constexpr (_max_bytes != 0) {
+            if (cache_.get_or_replace_if(_key, entry, is_replaceable).second) {
+              cache_.set_num_bytes(_key, internal::estimate_size(*res));
+            }
+          } else {
+            cache_.get_or_replace_if(_key, entry, is_replaceable);
+          }
+        }
+      } catch (...) {
+        // Nobody waits for the refresh, so there is nobody to report this
+        // to. _old is kept, just like when the query fails.
+      }
+      _old->is_refreshing = false;
+    });
+  }
+
+  inline static CacheType cache_ = CacheType(_max_size, _max_bytes);
 };
 
-template <class QueryT, size_t _max_size>
+struct Ttl {
+  std::chrono::steady_clock::duration val;
+};
+
+struct SoftTtl {
+  std::chrono::steady_clock::duration val;
+};
+
+/// Results older than _val are not served anymore, the query is executed
+/// again instead.
+inline auto ttl(const std::chrono::steady_clock::duration _val) {
+  return Ttl{_val};
+}
+
+/// Results older than _val are still served, but refreshed in the
+/// background (stale-while-revalidate). Cached queries with a soft_ttl must
+/// be called with a ConnectionPool, so that the refresh can use a session of
+/// its own.
+inline auto soft_ttl(const std::chrono::steady_clock::duration _val) {
+  return SoftTtl{_val};
+}
+
+template <class QueryT, size_t _max_size, size_t _max_bytes,
+          bool _has_soft_ttl = false>
 struct Cache {
   template <class Connection>
     requires is_connection<Connection>
   auto operator()(const Ref<Connection>& _conn) const {
-    return CacheImpl<QueryT, std::remove_cvref_t<Connection>, _max_size>::fetch(
-        query_, _conn);
+    static_assert(!_has_soft_ttl,
+                  "Results with a soft_ttl are refreshed in the background, "
+                  "on a session of their own, so the cached query must be "
+                  "called with a ConnectionPool.");
+    return CacheImpl<QueryT, std::remove_cvref_t<Connection>, _max_size,
+                     _max_bytes>::fetch(query_, _conn, options_);
   }
 
   template <class Connection>
@@ -93,26 +288,76 @@ struct Cache {
         [&](const Ref<Connection>& _conn) { return (*this)(_conn); });
   }
 
+  template <class Connection>
+    requires is_connection<Connection>
+  auto operator()(const ConnectionPool<Connection>& _pool) const {
+    return CacheImpl<QueryT, Session<Connection>, _max_size,
+                     _max_bytes>::fetch(query_, _pool, options_);
+  }
+
+  template <class Connection>
+    requires is_connection<Connection>
+  auto operator()(const Result<ConnectionPool<Connection>>& _res) const {
+    return _res.and_then([&](const ConnectionPool<Connection>& _pool) {
+      return (*this)(_pool);
+    });
+  }
+
   template <class Connection>
     requires is_connection<Connection>
   static const auto& cache(const Ref<Connection>& _conn) {
-    return CacheImpl<QueryT, std::remove_cvref_t<Connection>,
-                     _max_size>::cache();
+    return CacheImpl<QueryT, std::remove_cvref_t<Connection>, _max_size,
+                     _max_bytes>::cache();
   }
 
   template <class Connection>
     requires is_connection<Connection>
   static const auto& cache(const Result<Ref<Connection>>& _res) {
-    return CacheImpl<QueryT, std::remove_cvref_t<Connection>,
-                     _max_size>::cache();
+    return CacheImpl<QueryT, std::remove_cvref_t<Connection>, _max_size,
+                     _max_bytes>::cache();
+  }
+
+  template <class Connection>
+    requires is_connection<Connection>
+  static const auto& cache(const ConnectionPool<Connection>& _pool) {
+    return CacheImpl<QueryT, Session<Connection>, _max_size,
+                     _max_bytes>::cache();
+  }
+
+  template <class Connection>
+    requires is_connection<Connection>
+  static const auto& cache(const Result<ConnectionPool<Connection>>& _res) {
+    return CacheImpl<QueryT, Session<Connection>, _max_size,
+                     _max_bytes>::cache();
+  }
+
+  friend auto operator|(const Cache& _c, const Ttl& _ttl) {
+    auto c = _c;
+    c.options_.ttl = _ttl.val;
+    return c;
+  }
+
+  friend auto operator|(const Cache& _c, const SoftTtl& _soft_ttl) {
+    auto c = Cache<QueryT, _max_size, _max_bytes, true>{
+        .query_ = _c.query_, .options_ = _c.options_};
+    c.options_.soft_ttl = _soft_ttl.val;
+    return c;
   }
 
   QueryT query_;
+
+  internal::CacheOptions options_;
 };
 
-template <size_t _max_size = 2056, class QueryT>
+/// Caches the results of _query. At most _max_size results are kept (0 means
+/// no limit) and, if _max_bytes is not 0, at most about _max_bytes bytes of
+/// them. Once either limit is exceeded, the least recently used results are
+/// evicted. Pipe the result into ttl(...) or soft_ttl(...) to limit how long
+/// results are served.
+template <size_t _max_size = 2056, size_t _max_bytes = 0, class QueryT>
 auto cache(const QueryT& _query) {
-  return Cache<std::remove_cvref_t<QueryT>, _max_size>{.query_ = _query};
+  return Cache<std::remove_cvref_t<QueryT>, _max_size, _max_bytes>{
+      .query_ = _query};
 }
 
 }  // namespace sqlgen
@@ -3,8 +3,8 @@
 
 #include <rfl.hpp>
 
+#include "internal/static_sql.hpp"
 #include "is_connection.hpp"
-#include "transpilation/to_create_table.hpp"
 
 namespace sqlgen {
 
@@ -12,10 +12,12 @@ template <class ValueType, class Connection>
   requires is_connection<Connection>
 Result<Ref<Connection>> create_table_impl(const Ref<Connection>& _conn,
                                           const bool _if_not_exists) {
-  const auto query = transpilation::to_create_table<ValueType>(_if_not_exists);
-  return _conn->execute(_conn->to_sql(query)).transform([&](const auto&) {
-    return _conn;
-  });
+  using DialectType = internal::dialect_t<Connection>;
+  const auto& sql =
+      _if_not_exists
+          ? internal::create_table_sql<ValueType, DialectType, true>()
+          : internal::create_table_sql<ValueType, DialectType, false>();
+  return _conn->execute(sql).transform([&](const auto&) { return _conn; });
 }
 
 template <class ValueType, class Connection>
@@ -5,7 +5,10 @@
 
 #include "Ref.hpp"
 #include "Result.hpp"
+#include "internal/invalidate_cached.hpp"
+#include "internal/static_sql.hpp"
 #include "is_connection.hpp"
+#include "transpilation/get_tablename.hpp"
 #include "transpilation/to_delete_from.hpp"
 #include "where.hpp"
 
@@ -15,11 +18,20 @@ template <class ValueType, class WhereType, class Connection>
   requires is_connection<Connection>
 Result<Ref<Connection>> delete_from_impl(const Ref<Connection>& _conn,
                                          const WhereType& _where) {
-  const auto query =
-      transpilation::to_delete_from<ValueType, WhereType>(_where);
-  return _conn->execute(_conn->to_sql(query)).transform([&](const auto&) {
-    return _conn;
-  });
+  const auto res = [&]() {
+    if constexpr (std::is_same_v<WhereType, Nothing>) {
+      using DialectType = internal::dialect_t<Connection>;
+      return _conn->execute(
+          internal::delete_from_sql<ValueType, DialectType>());
+    } else {
+      const auto query =
+          transpilation::to_delete_from<ValueType, WhereType>(_where);
+      return _conn->execute(_conn->to_sql(query));
+    }
+  }();
+  internal::invalidate_cached(_conn,
+                              transpilation::get_tablename<ValueType>());
+  return res.transform([&](const auto&) { return _conn; });
 }
 
 template <class ValueType, class WhereType, class Connection>
@@ -5,6 +5,7 @@
 
 #include "Ref.hpp"
 #include "Result.hpp"
+#include "internal/invalidate_cached.hpp"
 #include "is_connection.hpp"
 #include "transpilation/get_table_or_view.hpp"
 #include "transpilation/to_drop.hpp"
@@ -18,9 +19,9 @@ Result<Ref<Connection>> drop_impl(const Ref<Connection>& _conn,
                                   const bool _if_exists, const bool _cascade) {
   const auto query =
       transpilation::to_drop<ValueType>(_what, _if_exists, _cascade);
-  return _conn->execute(_conn->to_sql(query)).transform([&](const auto&) {
-    return _conn;
-  });
+  const auto res = _conn->execute(_conn->to_sql(query));
+  internal::invalidate_cached(_conn, query.table.name);
+  return res.transform([&](const auto&) { return _conn; });
 }
 
 template <class ValueType, class Connection>
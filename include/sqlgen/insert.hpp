@@ -10,10 +10,14 @@
 #include <utility>
 #include <vector>
 
-#include "internal/batch_size.hpp"
+#include "batch_size.hpp"
+#include "internal/WriteOptions.hpp"
 #include "internal/has_constraint.hpp"
+#include "internal/invalidate_cached.hpp"
+#include "internal/static_sql.hpp"
 #include "internal/to_str_vec.hpp"
 #include "is_connection.hpp"
+#include "transpilation/get_tablename.hpp"
 #include "transpilation/to_insert_or_write.hpp"
 #include "transpilation/value_t.hpp"
 
@@ -23,53 +27,72 @@ template <class ItBegin, class ItEnd, class Connection>
   requires is_connection<Connection>
 Result<Ref<Connection>> insert_impl(const Ref<Connection>& _conn,
                                     ItBegin _begin, ItEnd _end,
-                                    bool _or_replace) {
+                                    bool _or_replace,
+                                    const internal::WriteOptions& _options) {
   using T =
       std::remove_cvref_t<typename std::iterator_traits<ItBegin>::value_type>;
 
-  const auto insert_stmt =
-      transpilation::to_insert_or_write<T, dynamic::Insert>(_or_replace);
+  using DialectType = internal::dialect_t<Connection>;
 
-  return _conn->insert(insert_stmt, _begin, _end).transform([&](const auto&) {
-    return _conn;
-  });
+  const auto& sql = _or_replace
+                        ? internal::insert_or_replace_sql<T, DialectType>()
+                        : internal::insert_sql<T, DialectType>();
+
+  const auto res = _conn->insert(sql, _begin, _end, _options);
+  internal::invalidate_cached(_conn, transpilation::get_tablename<T>());
+  return res.transform([&](const auto&) { return _conn; });
 }
 
 template <class ItBegin, class ItEnd, class Connection>
   requires is_connection<Connection>
 Result<Ref<Connection>> insert_impl(const Result<Ref<Connection>>& _res,
                                     ItBegin _begin, ItEnd _end,
-                                    bool _or_replace) {
+                                    bool _or_replace,
+                                    const internal::WriteOptions& _options) {
   return _res.and_then([&](const auto& _conn) {
-    return insert_impl(_conn, _begin, _end, _or_replace);
+    return insert_impl(_conn, _begin, _end, _or_replace, _options);
   });
 }
 
 template <class ContainerType>
 auto insert_impl(const auto& _conn, const ContainerType& _data,
-                 bool _or_replace) {
+                 bool _or_replace, const internal::WriteOptions& _options) {
   if constexpr (std::ranges::input_range<std::remove_cvref_t<ContainerType>>) {
-    return insert_impl(_conn, _data.begin(), _data.end(), _or_replace);
+    return insert_impl(_conn, _data.begin(), _data.end(), _or_replace,
+                       _options);
   } else {
-    return insert_impl(_conn, &_data, &_data + 1, _or_replace);
+    return insert_impl(_conn, &_data, &_data + 1, _or_replace, _options);
   }
 }
 
 template <class ContainerType>
 auto insert_impl(const auto& _conn,
                  const std::reference_wrapper<ContainerType>& _data,
-                 bool _or_replace) {
-  return insert_impl(_conn, _data.get(), _or_replace);
+                 bool _or_replace, const internal::WriteOptions& _options) {
+  return insert_impl(_conn, _data.get(), _or_replace, _options);
 }
 
 template <class ContainerType>
 struct Insert {
   auto operator()(const auto& _conn) const {
-    return insert_impl(_conn, data_, or_replace_);
+    return insert_impl(_conn, data_, or_replace_, options_);
+  }
+
+  friend auto operator|(const Insert& _i, const BatchSize& _b) {
+    auto i = _i;
+    i.options_.batch_size = _b.val;
+    return i;
+  }
+
+  friend auto operator|(const Insert& _i, const BatchBytes& _b) {
+    auto i = _i;
+    i.options_.batch_bytes = _b.val;
+    return i;
   }
 
   ContainerType data_;
   bool or_replace_;
+  internal::WriteOptions options_;
 };
 
 template <class ContainerType>
@@ -80,7 +103,11 @@ Insert<ContainerType> insert_impl(const ContainerType& _data,
 
 template <class... Args>
 auto insert(const Args&... args) {
-  return insert_impl(args..., false);
+  if constexpr (sizeof...(Args) == 1) {
+    return insert_impl(args..., false);
+  } else {
+    return insert_impl(args..., false, internal::WriteOptions{});
+  }
 }
 
 template <class ContainerType>
@@ -89,7 +116,7 @@ auto insert_or_replace(const auto& _conn, const ContainerType& _data) {
       internal::has_constraint_v<transpilation::value_t<ContainerType>>,
       "The table must have a primary key or unique column for "
       "insert_or_replace(...) to work.");
-  return insert_impl(_conn, _data, true);
+  return insert_impl(_conn, _data, true, internal::WriteOptions{});
 }
 
 template <class ContainerType>
@@ -0,0 +1,66 @@
+#ifndef SQLGEN_INTERNAL_ATOMICHISTOGRAM_HPP_
+#define SQLGEN_INTERNAL_ATOMICHISTOGRAM_HPP_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "../ConnectionPoolMetrics.hpp"
+
+namespace sqlgen::internal {
+
+/// A histogram of durations that can be recorded to from many threads at
+/// once without taking a lock. The buckets grow by a factor of two, starting
+/// at 1us, so that recording a duration only takes a bit_width and two
+/// relaxed increments.
+class AtomicHistogram {
+ public:
+  /// The buckets cover durations of up to 2^(NUM_BUCKETS - 2)us, which is
+  /// roughly 33s. Anything longer goes into the last bucket.
+  static constexpr size_t NUM_BUCKETS = 27;
+
+  void record(const std::chrono::steady_clock::duration _d) noexcept {
+    const auto us = static_cast<uint64_t>(std::max(
+        std::chrono::duration_cast<std::chrono::microseconds>(_d).count(),
+        std::chrono::microseconds::rep(0)));
+    const auto ix = std::min(static_cast<size_t>(std::bit_width(us)),
+                             NUM_BUCKETS - 1);
+    counts_[ix].fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(us, std::memory_order_relaxed);
+  }
+
+  /// The counts are read one after the other, so a snapshot taken while
+  /// durations are being recorded may be off by the durations recorded
+  /// during the snapshot.
+  Histogram snapshot() const {
+    Histogram h;
+    h.upper_bounds.reserve(NUM_BUCKETS - 1);
+    h.counts.reserve(NUM_BUCKETS);
+    for (size_t i = 0; i < NUM_BUCKETS; ++i) {
+      if (i + 1 < NUM_BUCKETS) {
+        h.upper_bounds.emplace_back(int64_t(1) << i);
+      }
+      h.counts.push_back(counts_[i].load(std::memory_order_relaxed));
+      h.count += h.counts.back();
+    }
+    h.sum = std::chrono::microseconds(
+        static_cast<int64_t>(sum_.load(std::memory_order_relaxed)));
+    return h;
+  }
+
+ private:
+  /// Bucket i contains the durations d with 2^(i-1)us <= d < 2^i us, bucket
+  /// 0 those shorter than 1us.
+  std::array<std::atomic<uint64_t>, NUM_BUCKETS> counts_ = {};
+
+  /// The sum of all durations in microseconds.
+  std::atomic<uint64_t> sum_ = 0;
+};
+
+}  // namespace sqlgen::internal
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef SQLGEN_INTERNAL_CACHEOPTIONS_HPP_
+#define SQLGEN_INTERNAL_CACHEOPTIONS_HPP_
+
+#include <chrono>
+
+namespace sqlgen::internal {
+
+/// Controls how long cached results are served. This is set through the
+/// ttl and soft_ttl modifiers on cache.
+struct CacheOptions {
+  using Duration = std::chrono::steady_clock::duration;
+
+  /// If this is not 0, results older than this are not served anymore, the
+  /// query is executed again instead.
+  Duration ttl = Duration::zero();
+
+  /// If this is not 0, results older than this are still served, but the
+  /// first caller that finds them starts a refresh in the background, on a
+  /// session of its own. This is only used, if the cached query is called
+  /// with a ConnectionPool.
+  Duration soft_ttl = Duration::zero();
+};
+
+}  // namespace sqlgen::internal
+
+#endif
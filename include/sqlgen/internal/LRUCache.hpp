@@ -0,0 +1,205 @@
+#ifndef SQLGEN_INTERNAL_LRUCACHE_HPP_
+#define SQLGEN_INTERNAL_LRUCACHE_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace sqlgen::internal {
+
+/// A thread-safe cache that evicts the least recently used entries, once it
+/// holds more than max_size entries or, if max_bytes is not 0, once the
+/// entries take up more than max_bytes bytes.
+///
+/// The entries are kept in a linked list ordered by their last use, which a
+/// hash map indexes into, so that looking up, inserting and evicting an entry
+/// all take constant time.
+template <class KeyType, class ValueType, class HashType = std::hash<KeyType>>
+class LRUCache {
+  struct Entry {
+    KeyType key;
+    ValueType value;
+    size_t num_bytes;
+  };
+
+  using Iterator = typename std::list<Entry>::iterator;
+
+ public:
+  LRUCache(const size_t _max_size, const size_t _max_bytes = 0)
+      : max_size_(_max_size == 0 ? std::numeric_limits<size_t>::max()
+                                 : _max_size),
+        max_bytes_(_max_bytes),
+        num_bytes_(0) {}
+
+  /// Returns the value for _key and marks it as the most recently used one.
+  std::optional<ValueType> get(const KeyType& _key) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    const auto it = index_.find(_key);
+    if (it == index_.end()) {
+      return std::nullopt;
+    }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->value;
+  }
+
+  /// Returns the value for _key and marks it as the most recently used one.
+  /// If there is none, inserts _value instead, in a single step, so that
+  /// only one of several threads looking for the same key inserts a value.
+  /// The second element of the pair is true, if _value has been inserted.
+  std::pair<ValueType, bool> get_or_put(const KeyType& _key,
+                                        const ValueType& _value,
+                                        const size_t _num_bytes = 0) {
+    return get_or_replace_if(
+        _key, _value, [](const auto&) { return false; }, _num_bytes);
+  }
+
+  /// Like get_or_put, but also replaces the value for _key by _value, if
+  /// _is_stale returns true for it.
+  template <class PredType>
+  std::pair<ValueType, bool> get_or_replace_if(const KeyType& _key,
+                                               const ValueType& _value,
+                                               const PredType& _is_stale,
+                                               const size_t _num_bytes = 0) {
+    std::vector<Entry> evicted;
+
+    std::lock_guard<std::mutex> lock(mtx_);
+    const auto it = index_.find(_key);
+    if (it != index_.end()) {
+      if (!_is_stale(it->second->value)) {
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return std::make_pair(it->second->value, false);
+      }
+      num_bytes_ -= it->second->num_bytes;
+      evicted.emplace_back(std::move(*it->second));
+      entries_.erase(it->second);
+      index_.erase(it);
+    }
+    entries_.push_front(Entry{_key, _value, _num_bytes});
+    index_.emplace(_key, entries_.begin());
+    num_bytes_ += _num_bytes;
+    evict(&evicted);
+    return std::make_pair(_value, true);
+  }
+
+  /// Inserts or replaces the value for _key, marks it as the most recently
+  /// used one and evicts other entries, if necessary.
+  void put(const KeyType& _key, const ValueType& _value,
+           const size_t _num_bytes = 0) {
+    // Declared before the lock, so the evicted values are destroyed after it
+    // has been released.
+    std::vector<Entry> evicted;
+
+    std::lock_guard<std::mutex> lock(mtx_);
+    const auto it = index_.find(_key);
+    if (it != index_.end()) {
+      num_bytes_ -= it->second->num_bytes;
+      entries_.erase(it->second);
+      index_.erase(it);
+    }
+    entries_.push_front(Entry{_key, _value, _num_bytes});
+    index_.emplace(_key, entries_.begin());
+    num_bytes_ += _num_bytes;
+    evict(&evicted);
+  }
+
+  /// Updates the size of the entry for _key, if it still exists, for
+  /// instance once a value that has been computed asynchronously is ready.
+  void set_num_bytes(const KeyType& _key, const size_t _num_bytes) {
+    std::vector<Entry> evicted;
+
+    std::lock_guard<std::mutex> lock(mtx_);
+    const auto it = index_.find(_key);
+    if (it == index_.end()) {
+      return;
+    }
+    num_bytes_ = num_bytes_ - it->second->num_bytes + _num_bytes;
+    it->second->num_bytes = _num_bytes;
+    evict(&evicted);
+  }
+
+  /// Removes the entry for _key, if there is one.
+  void erase(const KeyType& _key) {
+    erase_if(_key, [](const auto&) { return true; });
+  }
+
+  /// Removes the entry for _key, if there is one and _pred returns true for
+  /// its value.
+  template <class PredType>
+  void erase_if(const KeyType& _key, const PredType& _pred) {
+    std::optional<Entry> erased;
+
+    std::lock_guard<std::mutex> lock(mtx_);
+    const auto it = index_.find(_key);
+    if (it == index_.end() || !_pred(it->second->value)) {
+      return;
+    }
+    num_bytes_ -= it->second->num_bytes;
+    erased = std::move(*it->second);
+    entries_.erase(it->second);
+    index_.erase(it);
+  }
+
+  /// Removes all entries.
+  void clear() {
+    std::list<Entry> entries;
+
+    std::lock_guard<std::mutex> lock(mtx_);
+    entries.swap(entries_);
+    index_.clear();
+    num_bytes_ = 0;
+  }
+
+  /// The number of entries.
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return entries_.size();
+  }
+
+  /// The number of bytes the entries take up, as far as they are known.
+  size_t num_bytes() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return num_bytes_;
+  }
+
+ private:
+  /// Removes the least recently used entries, until the limits are respected
+  /// again. The most recently used entry is always kept, even if it exceeds
+  /// max_bytes on its own. Must be called while holding the mutex.
+  void evict(std::vector<Entry>* _evicted) {
+    while (entries_.size() > max_size_ ||
+           (max_bytes_ != 0 && num_bytes_ > max_bytes_ &&
+            entries_.size() > 1)) {
+      auto& lru = entries_.back();
+      num_bytes_ -= lru.num_bytes;
+      index_.erase(lru.key);
+      _evicted->emplace_back(std::move(lru));
+      entries_.pop_back();
+    }
+  }
+
+ private:
+  const size_t max_size_;
+
+  const size_t max_bytes_;
+
+  /// The entries, the most recently used one first.
+  std::list<Entry> entries_;
+
+  /// Points to the entries in entries_.
+  std::unordered_map<KeyType, Iterator, HashType> index_;
+
+  /// The sum of the num_bytes of all entries.
+  size_t num_bytes_;
+
+  mutable std::mutex mtx_;
+};
+
+}  // namespace sqlgen::internal
+
+#endif
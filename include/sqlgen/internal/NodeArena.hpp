@@ -0,0 +1,130 @@
+#ifndef SQLGEN_INTERNAL_NODEARENA_HPP_
+#define SQLGEN_INTERNAL_NODEARENA_HPP_
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+#include "../Ref.hpp"
+
+namespace sqlgen::internal {
+
+/// A monotonic arena the nodes of a single dynamic statement are allocated
+/// from. Nested operations and conditions are linked through Ref<...>, so
+/// building them with Ref<...>::make(...) costs one heap allocation per node.
+/// Inside a NodeArena::Scope, make_node(...) carves the nodes out of a common
+/// buffer instead, which means that a typical statement needs a single
+/// allocation, no matter how deeply its filters are nested.
+///
+/// Every node keeps the arena alive, so the nodes remain ordinary
+/// Ref<...>: They can be copied, cached and destroyed on any thread, and the
+/// memory is released at once when the last node of the statement is gone.
+class NodeArena {
+  static constexpr size_t INITIAL_SIZE = 2048;
+
+  template <class T>
+  class Allocator {
+    template <class>
+    friend class Allocator;
+
+   public:
+    using value_type = T;
+
+    explicit Allocator(std::shared_ptr<NodeArena> _arena) noexcept
+        : arena_(std::move(_arena)) {}
+
+    template <class U>
+    Allocator(const Allocator<U>& _other) noexcept : arena_(_other.arena_) {}
+
+    T* allocate(const size_t _n) {
+      return static_cast<T*>(
+          arena_->resource_.allocate(_n * sizeof(T), alignof(T)));
+    }
+
+    /// This is a no-op, the memory is released with the arena.
+    void deallocate(T* _ptr, const size_t _n) noexcept {
+      arena_->resource_.deallocate(_ptr, _n * sizeof(T), alignof(T));
+    }
+
+    template <class U>
+    bool operator==(const Allocator<U>& _other) const noexcept {
+      return arena_ == _other.arena_;
+    }
+
+   private:
+    std::shared_ptr<NodeArena> arena_;
+  };
+
+ public:
+  /// Routes all calls to make_node(...) on the current thread to a common
+  /// arena for as long as the scope exists. The arena is only created once
+  /// the first node is, so statements without any nested nodes do not pay
+  /// for it. Nested scopes share the arena of the outermost one, so a
+  /// subquery ends up in the same arena as its enclosing statement.
+  class Scope {
+   public:
+    Scope() : outermost_(!active_) { active_ = true; }
+
+    ~Scope() {
+      if (outermost_) {
+        active_ = false;
+        current_.reset();
+      }
+    }
+
+    Scope(const Scope&) = delete;
+
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    /// Whether this scope owns the arena.
+    bool outermost_;
+  };
+
+  NodeArena() : resource_(buffer_.data(), buffer_.size()) {}
+
+  NodeArena(const NodeArena&) = delete;
+
+  NodeArena& operator=(const NodeArena&) = delete;
+
+  /// Creates a new node in the arena of the active scope, or on the heap, if
+  /// there is no active scope on this thread.
+  template <class T, class... Args>
+  static Ref<T> make_node(Args&&... _args) {
+    if (!active_) {
+      return Ref<T>::make(std::forward<Args>(_args)...);
+    }
+    if (!current_) {
+      current_ = std::make_shared<NodeArena>();
+    }
+    const auto ptr = std::allocate_shared<T>(Allocator<T>(current_),
+                                             std::forward<Args>(_args)...);
+    return Ref<T>::make(ptr).value();
+  }
+
+ private:
+  /// Whether there is an active scope on this thread.
+  inline static thread_local bool active_ = false;
+
+  /// The arena of the active scope on this thread, once it has been created.
+  inline static thread_local std::shared_ptr<NodeArena> current_;
+
+  /// The first chunk of the arena, which lives inside the same allocation as
+  /// the arena itself.
+  alignas(std::max_align_t) std::array<std::byte, INITIAL_SIZE> buffer_;
+
+  /// Falls back to the heap, once buffer_ is exhausted.
+  std::pmr::monotonic_buffer_resource resource_;
+};
+
+/// Shorthand for NodeArena::make_node<T>(...).
+template <class T, class... Args>
+Ref<T> make_node(Args&&... _args) {
+  return NodeArena::make_node<T>(std::forward<Args>(_args)...);
+}
+
+}  // namespace sqlgen::internal
+
+#endif
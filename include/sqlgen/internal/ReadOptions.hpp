@@ -0,0 +1,63 @@
+#ifndef SQLGEN_INTERNAL_READOPTIONS_HPP_
+#define SQLGEN_INTERNAL_READOPTIONS_HPP_
+
+#include <cstddef>
+
+#include "batch_size.hpp"
+
+namespace sqlgen::internal {
+
+/// Controls how the results of a query are fetched from the database. This
+/// is set through modifiers on read and select_from and handed down to
+/// sqlgen::Iterator.
+struct ReadOptions {
+  /// Results limited to at most this many rows count as small.
+  static constexpr size_t MAX_SMALL_RESULT = 1000;
+
+  /// Whether the next batch should be fetched and parsed on a background
+  /// thread while the current one is being consumed.
+  bool prefetch = false;
+
+  /// The maximum number of threads the rows of a batch are parsed on. The
+  /// calling thread is one of them, the others are taken from a process-wide
+  /// pool.
+  size_t decode_threads = 1;
+
+  /// The maximum number of rows fetched from the database at once.
+  size_t batch_size = SQLGEN_BATCH_SIZE;
+
+  /// If this is not 0, a batch is also cut off, once its cells take up at
+  /// least this many bytes.
+  size_t batch_bytes = 0;
+
+  /// If this is not 0, the first batch only contains this many rows and
+  /// every following batch is batch_growth times larger than the previous
+  /// one, until batch_size is reached. This gets the first rows to the caller
+  /// quickly, while still using large batches for long results.
+  size_t initial_batch_size = 0;
+
+  /// The factor by which the batches grow, if initial_batch_size is set.
+  size_t batch_growth = 2;
+
+  /// Whether the query is known to return a small result. Backends that
+  /// would otherwise read through a cursor may then fetch the complete
+  /// result at once.
+  bool small_result = false;
+};
+
+/// Marks the result as small, if the query is limited to at most
+/// MAX_SMALL_RESULT rows.
+template <class LimitType>
+ReadOptions apply_limit(const ReadOptions& _options, const LimitType& _limit) {
+  auto options = _options;
+  if constexpr (requires { _limit.val; }) {
+    if (_limit.val <= ReadOptions::MAX_SMALL_RESULT) {
+      options.small_result = true;
+    }
+  }
+  return options;
+}
+
+}  // namespace sqlgen::internal
+
+#endif
@@ -0,0 +1,161 @@
+#ifndef SQLGEN_INTERNAL_ROWBATCH_HPP_
+#define SQLGEN_INTERNAL_ROWBATCH_HPP_
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace sqlgen::internal {
+
+/// A batch of rows in their string representation. This is the format used to
+/// exchange data between the backends and the parsers, in both directions.
+///
+/// All cells are stored back-to-back in a single buffer, each followed by a
+/// terminating '\0', so they can be handed to C APIs directly. The cell
+/// boundaries are kept in an offset array and NULL values in a separate
+/// array. A batch therefore costs a constant number of allocations, no matter
+/// how many rows and columns it contains, and can be reused after clear().
+class RowBatch {
+ public:
+  /// A view on a single row inside the batch.
+  class Row {
+   public:
+    Row(const RowBatch* _batch, const size_t _first_cell)
+        : batch_(_batch), first_cell_(_first_cell) {}
+
+    /// Returns the cell in column _j, or std::nullopt, if it is NULL.
+    std::optional<std::string_view> operator[](const size_t _j) const noexcept {
+      return batch_->cell(first_cell_ + _j);
+    }
+
+    /// Returns a null-terminated pointer to the cell in column _j, or nullptr,
+    /// if it is NULL.
+    const char* c_str(const size_t _j) const noexcept {
+      return batch_->cell_c_str(first_cell_ + _j);
+    }
+
+    /// The length of the cell in column _j, excluding the terminating '\0'.
+    size_t length(const size_t _j) const noexcept {
+      return batch_->cell_length(first_cell_ + _j);
+    }
+
+    size_t size() const noexcept { return batch_->num_cols(); }
+
+   private:
+    const RowBatch* batch_;
+
+    size_t first_cell_;
+  };
+
+  RowBatch() : num_cols_(0), num_rows_(0), offsets_({0}) {}
+
+  ~RowBatch() = default;
+
+  /// Appends a non-NULL cell to the current row.
+  void append(const std::string_view _str) {
+    data_.append(_str);
+    data_.push_back('\0');
+    offsets_.push_back(data_.size());
+    is_null_.push_back(false);
+  }
+
+  /// Appends a non-NULL cell that is written in place by _f. _f receives a
+  /// pointer to _max_size writable bytes and must return a pointer one past
+  /// the last byte it has written.
+  template <class F>
+  void append_with(const size_t _max_size, const F& _f) {
+    const auto begin = data_.size();
+    data_.resize(begin + _max_size);
+    const char* end = _f(data_.data() + begin);
+    data_.resize(static_cast<size_t>(end - data_.data()));
+    data_.push_back('\0');
+    offsets_.push_back(data_.size());
+    is_null_.push_back(false);
+  }
+
+  /// Appends a NULL cell to the current row.
+  void append_null() {
+    offsets_.push_back(data_.size());
+    is_null_.push_back(true);
+  }
+
+  /// Marks the end of the current row. The number of columns is inferred from
+  /// the first row.
+  void end_row() noexcept {
+    if (num_rows_ == 0) {
+      num_cols_ = is_null_.size();
+    }
+    ++num_rows_;
+  }
+
+  /// Removes all rows, but keeps the allocated memory.
+  void clear() noexcept {
+    data_.clear();
+    offsets_.resize(1);
+    is_null_.clear();
+    num_cols_ = 0;
+    num_rows_ = 0;
+  }
+
+  /// Whether the batch contains any rows.
+  bool empty() const noexcept { return num_rows_ == 0; }
+
+  /// The number of bytes currently used by the cell data.
+  size_t num_bytes() const noexcept { return data_.size(); }
+
+  size_t num_cols() const noexcept { return num_cols_; }
+
+  /// Reserves memory for _num_cells cells containing a total of _num_bytes
+  /// bytes.
+  void reserve(const size_t _num_cells, const size_t _num_bytes) {
+    data_.reserve(_num_bytes + _num_cells);
+    offsets_.reserve(_num_cells + 1);
+    is_null_.reserve(_num_cells);
+  }
+
+  /// The number of rows in the batch.
+  size_t size() const noexcept { return num_rows_; }
+
+  Row operator[](const size_t _i) const noexcept {
+    return Row(this, _i * num_cols_);
+  }
+
+ private:
+  std::optional<std::string_view> cell(const size_t _ix) const noexcept {
+    if (is_null_[_ix]) {
+      return std::nullopt;
+    }
+    return std::string_view(data_.data() + offsets_[_ix], cell_length(_ix));
+  }
+
+  const char* cell_c_str(const size_t _ix) const noexcept {
+    return is_null_[_ix] ? nullptr : data_.data() + offsets_[_ix];
+  }
+
+  size_t cell_length(const size_t _ix) const noexcept {
+    return is_null_[_ix] ? 0 : offsets_[_ix + 1] - offsets_[_ix] - 1;
+  }
+
+ private:
+  /// The number of columns per row.
+  size_t num_cols_;
+
+  /// The number of complete rows.
+  size_t num_rows_;
+
+  /// The cells, each followed by '\0'.
+  std::string data_;
+
+  /// The offset of each cell in data_. Cell i spans
+  /// [offsets_[i], offsets_[i + 1]).
+  std::vector<size_t> offsets_;
+
+  /// Whether a cell is NULL.
+  std::vector<bool> is_null_;
+};
+
+}  // namespace sqlgen::internal
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef SQLGEN_INTERNAL_TABLEVERSIONS_HPP_
+#define SQLGEN_INTERNAL_TABLEVERSIONS_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace sqlgen::internal {
+
+/// Counts the writes to every table, so that caches can tell whether a
+/// result is still current: A cached result remembers the versions of the
+/// tables it was read from and is stale, once any of them has changed.
+/// Tables are identified by their name only, so writing to a table in one
+/// schema or database also invalidates results from equally named tables in
+/// others, which is wasteful, but safe.
+class TableVersions {
+ public:
+  using Counter = std::atomic<uint64_t>;
+
+  /// The versions shared by all caches in the process.
+  static TableVersions& instance() {
+    static TableVersions versions;
+    return versions;
+  }
+
+  /// Returns the counter for _table, creating it if necessary. Counters are
+  /// never removed, so the pointer remains valid for the rest of the
+  /// process.
+  const Counter* counter(const std::string& _table) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto& c = counters_[_table];
+    if (!c) {
+      c = std::make_unique<Counter>(0);
+    }
+    return c.get();
+  }
+
+  /// Marks all results read from _table as stale. Must be called after the
+  /// write has become visible to other connections, or else a result read
+  /// in between could be taken for a current one.
+  void bump(const std::string& _table) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    const auto it = counters_.find(_table);
+    if (it != counters_.end()) {
+      it->second->fetch_add(1, std::memory_order_release);
+    }
+  }
+
+  /// Marks all cached results as stale, for instance when notifications
+  /// about writes may have been missed.
+  void bump_all() {
+    std::lock_guard<std::mutex> lock(mtx_);
+    for (auto& table_and_counter : counters_) {
+      table_and_counter.second->fetch_add(1, std::memory_order_release);
+    }
+  }
+
+ private:
+  std::mutex mtx_;
+
+  /// Tables without a counter have never been read from by a cache, so
+  /// there is nothing to invalidate.
+  std::unordered_map<std::string, std::unique_ptr<Counter>> counters_;
+};
+
+}  // namespace sqlgen::internal
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef SQLGEN_INTERNAL_THREADPOOL_HPP_
+#define SQLGEN_INTERNAL_THREADPOOL_HPP_
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sqlgen::internal {
+
+/// A fixed set of worker threads that run tasks in the order they were
+/// submitted. sqlgen uses a single process-wide pool, which is created on
+/// first use, so that the threads are not started over and over for every
+/// batch.
+class ThreadPool {
+ public:
+  explicit ThreadPool(const size_t _num_threads) {
+    workers_.reserve(_num_threads);
+    for (size_t i = 0; i < _num_threads; ++i) {
+      workers_.emplace_back([this]() { work(); });
+    }
+  }
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mtx_);
+      stopped_ = true;
+    }
+    cv_.notify_all();
+    for (auto& w : workers_) {
+      w.join();
+    }
+  }
+
+  ThreadPool(const ThreadPool&) = delete;
+
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /// The pool shared by all queries, which has one thread per core.
+  static ThreadPool& instance() {
+    static ThreadPool pool(
+        std::max(std::thread::hardware_concurrency(), 1u));
+    return pool;
+  }
+
+  size_t size() const noexcept { return workers_.size(); }
+
+  /// Schedules _f and returns a future for its result.
+  template <class F>
+  auto submit(F&& _f) {
+    using ResultType = std::invoke_result_t<F>;
+    auto task = std::make_shared<std::packaged_task<ResultType()>>(
+        std::forward<F>(_f));
+    auto fut = task->get_future();
+    {
+      std::lock_guard<std::mutex> lock(mtx_);
+      tasks_.emplace_back([task]() { (*task)(); });
+    }
+    cv_.notify_one();
+    return fut;
+  }
+
+ private:
+  void work() {
+    while (true) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(mtx_);
+        cv_.wait(lock, [this]() { return stopped_ || !tasks_.empty(); });
+        if (tasks_.empty()) {
+          return;
+        }
+        task = std::move(tasks_.front());
+        tasks_.pop_front();
+      }
+      task();
+    }
+  }
+
+ private:
+  /// Signals the workers that there is a new task or that they should stop.
+  std::condition_variable cv_;
+
+  /// Protects tasks_ and stopped_.
+  std::mutex mtx_;
+
+  /// Whether the pool is shutting down.
+  bool stopped_ = false;
+
+  /// The tasks that have not been picked up by a worker yet.
+  std::deque<std::function<void()>> tasks_;
+
+  /// The worker threads.
+  std::vector<std::thread> workers_;
+};
+
+}  // namespace sqlgen::internal
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef SQLGEN_INTERNAL_WRITEOPTIONS_HPP_
+#define SQLGEN_INTERNAL_WRITEOPTIONS_HPP_
+
+#include <cstddef>
+
+#include "batch_size.hpp"
+
+namespace sqlgen::internal {
+
+/// Controls how data is sent to the database by write and insert. This is
+/// set through modifiers and handed down to the connections.
+struct WriteOptions {
+  /// The maximum number of rows sent to the database at once.
+  size_t batch_size = SQLGEN_BATCH_SIZE;
+
+  /// If this is not 0, a batch is also sent, once its cells take up at least
+  /// this many bytes.
+  size_t batch_bytes = 0;
+};
+
+}  // namespace sqlgen::internal
+
+#endif
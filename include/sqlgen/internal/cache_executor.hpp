@@ -0,0 +1,27 @@
+#ifndef SQLGEN_INTERNAL_CACHE_EXECUTOR_HPP_
+#define SQLGEN_INTERNAL_CACHE_EXECUTOR_HPP_
+
+#include <algorithm>
+#include <cstddef>
+
+#include "ThreadPool.hpp"
+
+#ifndef SQLGEN_CACHE_THREADS
+#define SQLGEN_CACHE_THREADS 4
+#endif
+
+namespace sqlgen::internal {
+
+/// The threads that run the queries of cache misses. This is not the pool
+/// that ThreadPool::instance() returns, because the queries block on the
+/// database and would otherwise hold up the decoding of batches. At most
+/// SQLGEN_CACHE_THREADS misses are fetched at the same time, any further ones
+/// wait in line.
+inline ThreadPool& cache_executor() {
+  static ThreadPool pool(std::max(size_t(SQLGEN_CACHE_THREADS), size_t(1)));
+  return pool;
+}
+
+}  // namespace sqlgen::internal
+
+#endif
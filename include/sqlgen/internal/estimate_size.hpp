@@ -0,0 +1,66 @@
+#ifndef SQLGEN_INTERNAL_ESTIMATE_SIZE_HPP_
+#define SQLGEN_INTERNAL_ESTIMATE_SIZE_HPP_
+
+#include <cstddef>
+#include <optional>
+#include <rfl.hpp>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace sqlgen::internal {
+
+/// The number of bytes _t takes up on the heap, as far as we can tell.
+template <class T>
+size_t estimate_heap_size(const T& _t) {
+  using Type = std::remove_cvref_t<T>;
+
+  if constexpr (std::is_same_v<Type, std::string>) {
+    // Short strings are stored inside of the object itself.
+    const auto begin = reinterpret_cast<const char*>(&_t);
+    const bool is_inline =
+        _t.data() >= begin && _t.data() < begin + sizeof(std::string);
+    return is_inline ? 0 : _t.capacity() + 1;
+
+  } else if constexpr (requires {
+                         _t.capacity();
+                         _t.begin();
+                         typename Type::value_type;
+                       }) {
+    size_t size = _t.capacity() * sizeof(typename Type::value_type);
+    for (const auto& v : _t) {
+      size += estimate_heap_size(v);
+    }
+    return size;
+
+  } else if constexpr (requires {
+                         _t.has_value();
+                         *_t;
+                       }) {
+    return _t ? estimate_heap_size(*_t) : 0;
+
+  } else if constexpr (std::is_aggregate_v<Type> && !std::is_array_v<Type>) {
+    size_t size = 0;
+    rfl::to_view(_t).apply([&](const auto& _field) {
+      size += estimate_heap_size(*_field.value());
+    });
+    return size;
+
+  } else {
+    return 0;
+  }
+}
+
+/// Estimates how many bytes _t takes up in memory, including what it owns on
+/// the heap. This is used to enforce the byte budget of caches, so it only
+/// needs to be roughly right: Strings, containers, optionals and the fields
+/// of reflectable structs are followed, anything else is counted by its
+/// sizeof.
+template <class T>
+size_t estimate_size(const T& _t) {
+  return sizeof(T) + estimate_heap_size(_t);
+}
+
+}  // namespace sqlgen::internal
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef SQLGEN_INTERNAL_GET_TABLES_HPP_
+#define SQLGEN_INTERNAL_GET_TABLES_HPP_
+
+#include <algorithm>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../dynamic/SelectFrom.hpp"
+#include "../dynamic/Statement.hpp"
+
+namespace sqlgen::internal {
+
+inline void get_tables(const dynamic::SelectFrom& _stmt,
+                       std::vector<std::string>* _tables);
+
+inline void get_tables(const dynamic::SelectFrom::TableOrQueryType& _t,
+                       std::vector<std::string>* _tables) {
+  _t.visit([&](const auto& _table_or_query) {
+    using Type = std::remove_cvref_t<decltype(_table_or_query)>;
+    if constexpr (std::is_same_v<Type, dynamic::Table>) {
+      _tables->push_back(_table_or_query.name);
+    } else {
+      get_tables(*_table_or_query, _tables);
+    }
+  });
+}
+
+inline void get_tables(const dynamic::SelectFrom& _stmt,
+                       std::vector<std::string>* _tables) {
+  get_tables(_stmt.table_or_query, _tables);
+  if (_stmt.joins) {
+    for (const auto& join : *_stmt.joins) {
+      get_tables(join.table_or_query, _tables);
+    }
+  }
+}
+
+/// Returns the names of all tables a statement reads from, including those
+/// in joins and subqueries, sorted and without duplicates.
+inline std::vector<std::string> get_tables(const dynamic::SelectFrom& _stmt) {
+  std::vector<std::string> tables;
+  get_tables(_stmt, &tables);
+  std::sort(tables.begin(), tables.end());
+  tables.erase(std::unique(tables.begin(), tables.end()), tables.end());
+  return tables;
+}
+
+/// Returns the tables a statement reads from, if it is a query, or an empty
+/// vector otherwise.
+inline std::vector<std::string> get_tables(const dynamic::Statement& _stmt) {
+  return _stmt.visit([](const auto& _s) -> std::vector<std::string> {
+    using Type = std::remove_cvref_t<decltype(_s)>;
+    if constexpr (std::is_same_v<Type, dynamic::SelectFrom>) {
+      return get_tables(_s);
+    } else {
+      return {};
+    }
+  });
+}
+
+}  // namespace sqlgen::internal
+
+#endif
@@ -0,0 +1,173 @@
+#ifndef SQLGEN_INTERNAL_HASH_STATEMENT_HPP_
+#define SQLGEN_INTERNAL_HASH_STATEMENT_HPP_
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <rfl.hpp>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../Ref.hpp"
+#include "../dynamic/Statement.hpp"
+
+namespace sqlgen::internal {
+
+/// A 128-bit hash of the structure and the values of a dynamic statement.
+/// Different statements may have the same hash, so it only narrows down the
+/// candidates, which then need to be compared by their encoding.
+struct StatementHash {
+  uint64_t h1 = 0;
+  uint64_t h2 = 0;
+
+  bool operator==(const StatementHash& _other) const = default;
+
+  /// For use in std::unordered_map and friends. The bits are already well
+  /// mixed, so any part of them will do.
+  struct Hasher {
+    size_t operator()(const StatementHash& _h) const noexcept {
+      return static_cast<size_t>(_h.h1);
+    }
+  };
+};
+
+/// A dynamic statement, encoded as a sequence of words, together with a hash
+/// of them. Two statements are equal, if and only if their words are.
+struct EncodedStatement {
+  StatementHash hash;
+  std::vector<uint64_t> words;
+};
+
+/// Walks a dynamic statement, encodes every node and value as words and feeds
+/// them into two independent 64-bit hashes. The dynamic types are aggregates,
+/// so apart from strings, containers and variants, they are taken apart using
+/// reflection. Strings and containers are prefixed by their size and the
+/// alternatives of variants by a type id, so that the encoding is
+/// unambiguous.
+class StatementHasher {
+  template <class T>
+  struct IsOptional : std::false_type {};
+
+  template <class T>
+  struct IsOptional<std::optional<T>> : std::true_type {};
+
+  template <class T>
+  struct IsVector : std::false_type {};
+
+  template <class T>
+  struct IsVector<std::vector<T>> : std::true_type {};
+
+  template <class T>
+  struct IsRef : std::false_type {};
+
+  template <class T>
+  struct IsRef<Ref<T>> : std::true_type {};
+
+  /// Its address identifies T within the process, which is all we need to
+  /// tell the alternatives of a variant apart.
+  template <class T>
+  static inline const char type_id_ = 0;
+
+ public:
+  StatementHash hash() const noexcept { return StatementHash{h1_, h2_}; }
+
+  std::vector<uint64_t>&& words() && noexcept { return std::move(words_); }
+
+  template <class T>
+  void add(const T& _t) {
+    using Type = std::remove_cvref_t<T>;
+
+    if constexpr (std::is_same_v<Type, std::string>) {
+      add_bytes(_t.data(), _t.size());
+
+    } else if constexpr (std::is_enum_v<Type>) {
+      add_word(static_cast<uint64_t>(_t));
+
+    } else if constexpr (std::is_integral_v<Type>) {
+      add_word(static_cast<uint64_t>(_t));
+
+    } else if constexpr (std::is_floating_point_v<Type>) {
+      add_word(std::bit_cast<uint64_t>(static_cast<double>(_t)));
+
+    } else if constexpr (IsOptional<Type>::value) {
+      add_word(_t ? 1 : 0);
+      if (_t) {
+        add(*_t);
+      }
+
+    } else if constexpr (IsVector<Type>::value) {
+      add_word(_t.size());
+      for (const auto& v : _t) {
+        add(v);
+      }
+
+    } else if constexpr (IsRef<Type>::value) {
+      add(*_t);
+
+    } else if constexpr (requires { _t.reflection(); }) {
+      add(_t.reflection());
+
+    } else if constexpr (requires { _t.visit([](const auto&) {}); }) {
+      _t.visit([&](const auto& _v) {
+        add_word(reinterpret_cast<uintptr_t>(
+            &type_id_<std::remove_cvref_t<decltype(_v)>>));
+        add(_v);
+      });
+
+    } else {
+      rfl::to_view(_t).apply([&](const auto& _field) { add(*_field.value()); });
+    }
+  }
+
+ private:
+  void add_bytes(const char* _data, const size_t _size) {
+    add_word(_size);
+    size_t i = 0;
+    for (; i + 8 <= _size; i += 8) {
+      uint64_t word = 0;
+      std::memcpy(&word, _data + i, 8);
+      add_word(word);
+    }
+    if (i < _size) {
+      uint64_t word = 0;
+      std::memcpy(&word, _data + i, _size - i);
+      add_word(word);
+    }
+  }
+
+  void add_word(const uint64_t _word) {
+    words_.push_back(_word);
+    h1_ = mix(h1_ ^ _word) * 0x9e3779b97f4a7c15ULL;
+    h2_ = mix(h2_ + _word * 0xc2b2ae3d27d4eb4fULL) ^ (h2_ >> 29);
+  }
+
+  /// The finalizer of splitmix64.
+  static uint64_t mix(uint64_t _x) noexcept {
+    _x = (_x ^ (_x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    _x = (_x ^ (_x >> 27)) * 0x94d049bb133111ebULL;
+    return _x ^ (_x >> 31);
+  }
+
+ private:
+  uint64_t h1_ = 0x243f6a8885a308d3ULL;
+
+  uint64_t h2_ = 0x13198a2e03707344ULL;
+
+  std::vector<uint64_t> words_;
+};
+
+/// Encodes and hashes a statement without rendering it to SQL.
+inline EncodedStatement encode_statement(const dynamic::Statement& _stmt) {
+  StatementHasher hasher;
+  hasher.add(_stmt);
+  const auto hash = hasher.hash();
+  return EncodedStatement{.hash = hash, .words = std::move(hasher).words()};
+}
+
+}  // namespace sqlgen::internal
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef SQLGEN_INTERNAL_INVALIDATE_CACHED_HPP_
+#define SQLGEN_INTERNAL_INVALIDATE_CACHED_HPP_
+
+#include <string>
+
+#include "../Ref.hpp"
+#include "TableVersions.hpp"
+
+namespace sqlgen::internal {
+
+/// Marks the cached results that were read from _table as stale, after
+/// something has been written to it through _conn. Transactions invalidate
+/// the table once more when they are committed, because a result read by
+/// another connection in the meantime would not contain the write yet.
+/// Connections that can announce writes to other processes do so as well.
+template <class Connection>
+void invalidate_cached(const Ref<Connection>& _conn,
+                       const std::string& _table) {
+  if constexpr (requires { _conn->invalidate_on_commit(_table); }) {
+    _conn->invalidate_on_commit(_table);
+  }
+  if constexpr (requires { _conn->notify_invalidation(_table); }) {
+    // The write has already happened, so a failed notification is no reason
+    // to report an error.
+    _conn->notify_invalidation(_table);
+  }
+  TableVersions::instance().bump(_table);
+}
+
+}  // namespace sqlgen::internal
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef SQLGEN_INTERNAL_STATIC_SQL_HPP_
+#define SQLGEN_INTERNAL_STATIC_SQL_HPP_
+
+#include <string>
+#include <type_traits>
+
+#include "../dynamic/Insert.hpp"
+#include "../dynamic/Write.hpp"
+#include "../transpilation/read_to_select_from.hpp"
+#include "../transpilation/to_create_table.hpp"
+#include "../transpilation/to_delete_from.hpp"
+#include "../transpilation/to_insert_or_write.hpp"
+
+namespace sqlgen::internal {
+
+/// Session and Transaction wrap another connection, but speak the same
+/// dialect.
+template <class Connection>
+struct Dialect {
+  using Type = Connection;
+};
+
+template <class Connection>
+  requires requires { typename Connection::ConnType; }
+struct Dialect<Connection> {
+  using Type = typename Dialect<typename Connection::ConnType>::Type;
+};
+
+template <class Connection>
+using dialect_t = typename Dialect<std::remove_cvref_t<Connection>>::Type;
+
+/// The statements below are fully determined by their template parameters,
+/// so they are transpiled once per type and dialect, on the first call, and
+/// kept in function-local statics. Unlike variables, these are never used
+/// before they have been initialized, even by the constructors of other
+/// globals, and their initialization is thread-safe. DialectType must be a
+/// connection type with a static to_sql(...), such as sqlite::Connection.
+
+template <class T, class DialectType>
+const std::string& insert_sql() {
+  static const std::string sql = DialectType::to_sql(
+      transpilation::to_insert_or_write<T, dynamic::Insert>(false));
+  return sql;
+}
+
+template <class T, class DialectType>
+const std::string& insert_or_replace_sql() {
+  static const std::string sql = DialectType::to_sql(
+      transpilation::to_insert_or_write<T, dynamic::Insert>(true));
+  return sql;
+}
+
+template <class T, class DialectType>
+const std::string& write_sql() {
+  static const std::string sql = DialectType::to_sql(
+      transpilation::to_insert_or_write<T, dynamic::Write>());
+  return sql;
+}
+
+template <class T, class DialectType, bool _if_not_exists>
+const std::string& create_table_sql() {
+  static const std::string sql =
+      DialectType::to_sql(transpilation::to_create_table<T>(_if_not_exists));
+  return sql;
+}
+
+/// A SELECT without a WHERE clause or LIMIT. Values in those clauses are
+/// inlined into the SQL, so queries using them cannot be precomputed.
+template <class T, class OrderByType, class DialectType>
+const std::string& read_sql() {
+  static const std::string sql = DialectType::to_sql(
+      transpilation::read_to_select_from<T, Nothing, OrderByType, Nothing>());
+  return sql;
+}
+
+/// A DELETE FROM without a WHERE clause.
+template <class T, class DialectType>
+const std::string& delete_from_sql() {
+  static const std::string sql =
+      DialectType::to_sql(transpilation::to_delete_from<T, Nothing>(Nothing{}));
+  return sql;
+}
+
+}  // namespace sqlgen::internal
+
+#endif
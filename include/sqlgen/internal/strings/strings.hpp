@@ -2,6 +2,7 @@
 #define SQLGEN_INTERNAL_STRINGS_STRINGS_HPP_
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "../../sqlgen_api.hpp"
@@ -23,6 +24,28 @@ SQLGEN_API std::string replace_all(const std::string& _str,
                                    const std::string& _from,
                                    const std::string& _to);
 
+/// Appends _str to _out, replacing every occurrence of _from with _to.
+SQLGEN_API void append_replace_all(const std::string_view _str,
+                                   const char _from,
+                                   const std::string_view _to,
+                                   std::string* _out);
+
+/// Appends the elements of _range to _out, separated by _delimiter. _append
+/// writes a single element to _out. Unlike join(...), this does not create
+/// any intermediate strings.
+template <class RangeType, class AppendType>
+void join_into(const std::string_view _delimiter, const RangeType& _range,
+               const AppendType& _append, std::string* _out) {
+  bool first = true;
+  for (const auto& elem : _range) {
+    if (!first) {
+      _out->append(_delimiter);
+    }
+    first = false;
+    _append(elem, _out);
+  }
+}
+
 SQLGEN_API std::vector<std::string> split(const std::string& _str,
                                           const std::string& _delimiter);
 
@@ -5,22 +5,23 @@
 #include <rfl.hpp>
 #include <string>
 #include <type_traits>
-#include <vector>
 
+#include "../parsing/Parser.hpp"
+#include "../parsing/write_to_batch.hpp"
+#include "RowBatch.hpp"
 #include "remove_auto_incr_primary_t.hpp"
-#include "to_str.hpp"
 
 namespace sqlgen::internal {
 
+/// Appends the string representation of _t to _batch as a new row.
 template <class T>
-std::vector<std::optional<std::string>> to_str_vec(const T& _t) {
+void to_str_vec(const T& _t, RowBatch* _batch) {
   const auto view = rfl::to_view(_t);
   using ViewType = remove_auto_incr_primary_t<decltype(view)>;
-  return rfl::apply(
-      [](auto... _ptrs) {
-        return std::vector<std::optional<std::string>>({to_str(*_ptrs)...});
-      },
+  rfl::apply(
+      [&](auto... _ptrs) { (parsing::write_to_batch(*_ptrs, _batch), ...); },
       ViewType(view).values());
+  _batch->end_row();
 }
 
 }  // namespace sqlgen::internal
@@ -12,6 +12,8 @@
 #include "dynamic/Statement.hpp"
 #include "dynamic/Write.hpp"
 #include "internal/MockTable.hpp"
+#include "internal/ReadOptions.hpp"
+#include "internal/WriteOptions.hpp"
 
 namespace sqlgen {
 
@@ -20,7 +22,8 @@ template <class ConnType>
 concept is_connection = requires(
     ConnType c, std::string _sql, dynamic::Statement _stmt,
     dynamic::SelectFrom _select_from, dynamic::Insert _insert,
-    const dynamic::Write& _write, std::vector<internal::MockTable> _data) {
+    const dynamic::Write& _write, std::vector<internal::MockTable> _data,
+    internal::ReadOptions _options, internal::WriteOptions _write_options) {
   /// Begins a transaction.
   { c.begin_transaction() } -> std::same_as<Result<Nothing>>;
 
@@ -36,25 +39,58 @@ concept is_connection = requires(
     c.insert(_insert, _data.begin(), _data.end())
   } -> std::same_as<Result<Nothing>>;
 
+  /// Inserts data using an INSERT statement that has already been transpiled.
+  {
+    c.insert(_sql, _data.begin(), _data.end())
+  } -> std::same_as<Result<Nothing>>;
+
+  /// Inserts data using an INSERT statement that has already been transpiled,
+  /// using the WriteOptions to control how the data is sent.
+  {
+    c.insert(_sql, _data.begin(), _data.end(), _write_options)
+  } -> std::same_as<Result<Nothing>>;
+
   /// Reads the results of a SelectFrom statement.
   {
     c.template read<std::vector<internal::MockTable>>(_select_from)
   } -> std::same_as<Result<std::vector<internal::MockTable>>>;
 
+  /// Reads the results of a SELECT statement that has already been transpiled.
+  {
+    c.template read<std::vector<internal::MockTable>>(_sql)
+  } -> std::same_as<Result<std::vector<internal::MockTable>>>;
+
+  /// Reads the results of a SELECT statement, using the ReadOptions to
+  /// control how they are fetched.
+  {
+    c.template read<std::vector<internal::MockTable>>(_sql, _options)
+  } -> std::same_as<Result<std::vector<internal::MockTable>>>;
+
   /// Commits a transaction.
   { c.rollback() } -> std::same_as<Result<Nothing>>;
 
-  /// Transpiles a statement to a particular SQL dialect.
-  { c.to_sql(_stmt) } -> std::same_as<std::string>;
+  /// Transpiles a statement to a particular SQL dialect. This must not depend
+  /// on the state of the connection.
+  { ConnType::to_sql(_stmt) } -> std::same_as<std::string>;
 
   /// Starts the write operation.
   { c.start_write(_write) } -> std::same_as<Result<Nothing>>;
 
+  /// Starts the write operation using a statement that has already been
+  /// transpiled.
+  { c.start_write(_sql) } -> std::same_as<Result<Nothing>>;
+
   /// Ends the write operation and thus commits the results.
   { c.end_write() } -> std::same_as<Result<Nothing>>;
 
   /// Writes data into a table.
   { c.write(_data.begin(), _data.end()) } -> std::same_as<Result<Nothing>>;
+
+  /// Writes data into a table, using the WriteOptions to control how the data
+  /// is sent.
+  {
+    c.write(_data.begin(), _data.end(), _write_options)
+  } -> std::same_as<Result<Nothing>>;
 };
 
 }  // namespace sqlgen
@@ -13,6 +13,11 @@ namespace sqlgen::mysql {
 /// Transpiles a dynamic general SQL statement to the mysql dialect.
 std::string SQLGEN_API to_sql_impl(const dynamic::Statement& _stmt) noexcept;
 
+/// Transpiles a dynamic general SQL statement to the mysql dialect and
+/// appends the result to _out.
+void SQLGEN_API to_sql_into(const dynamic::Statement& _stmt,
+                            std::string* _out) noexcept;
+
 /// Transpiles any  SQL statement to the mysql dialect.
 template <class T>
 std::string to_sql(const T& _t) noexcept {
@@ -0,0 +1,19 @@
+#ifndef SQLGEN_PARALLEL_DECODE_HPP_
+#define SQLGEN_PARALLEL_DECODE_HPP_
+
+#include <cstddef>
+
+namespace sqlgen {
+
+struct ParallelDecode {
+  size_t num_threads;
+};
+
+/// Parses the rows of every fetched batch on up to _num_threads threads.
+inline auto parallel_decode(const size_t _num_threads) {
+  return ParallelDecode{_num_threads};
+}
+
+}  // namespace sqlgen
+
+#endif
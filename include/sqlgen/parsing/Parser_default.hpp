@@ -11,6 +11,8 @@
 #include "../dynamic/types.hpp"
 #include "../transpilation/has_reflection_method.hpp"
 #include "Parser_base.hpp"
+#include "numbers.hpp"
+#include "write_to_batch.hpp"
 
 namespace sqlgen::parsing {
 
@@ -29,37 +31,33 @@ struct Parser {
         return error("NULL value encounted: Numeric value cannot be NULL.");
       }
 
-      try {
-        if constexpr (std::is_floating_point_v<Type>) {
-          return static_cast<Type>(std::stod(*_str));
-
-        } else if constexpr (std::is_same_v<Type, bool>) {
-          if (*_str == "t" || *_str == "T" || *_str == "true" ||
-              *_str == "TRUE") {
-            return true;
-          }
-          if (*_str == "f" || *_str == "F" || *_str == "false" ||
-              *_str == "FALSE") {
-            return false;
-          }
-          return std::stoi(*_str) != 0;
-
-        } else if constexpr (std::is_integral_v<Type>) {
-          return static_cast<Type>(std::stoll(*_str));
-
-        } else if constexpr (std::is_enum_v<Type>) {
-          if (auto res = rfl::string_to_enum<Type>(*_str)) {
-            return Type{*res};
-          } else {
-            return error(res.error());
-          }
+      if constexpr (std::is_floating_point_v<Type>) {
+        return read_floating_point<Type>(*_str);
 
+      } else if constexpr (std::is_same_v<Type, bool>) {
+        if (*_str == "t" || *_str == "T" || *_str == "true" ||
+            *_str == "TRUE") {
+          return true;
+        }
+        if (*_str == "f" || *_str == "F" || *_str == "false" ||
+            *_str == "FALSE") {
+          return false;
+        }
+        return read_integral<long long>(*_str).transform(
+            [](const long long _v) { return _v != 0; });
+
+      } else if constexpr (std::is_integral_v<Type>) {
+        return read_integral<Type>(*_str);
+
+      } else if constexpr (std::is_enum_v<Type>) {
+        if (auto res = rfl::string_to_enum<Type>(*_str)) {
+          return Type{*res};
         } else {
-          static_assert(rfl::always_false_v<Type>, "Unsupported type");
+          return error(res.error());
         }
 
-      } catch (std::exception& e) {
-        return error(e.what());
+      } else {
+        static_assert(rfl::always_false_v<Type>, "Unsupported type");
       }
     }
   }
@@ -70,8 +68,24 @@ struct Parser {
           _t.reflection());
     } else if constexpr (std::is_enum_v<Type>) {
       return rfl::enum_to_string(_t);
+    } else if constexpr (std::is_same_v<Type, bool>) {
+      return std::string(_t ? "1" : "0");
+    } else {
+      return write_number(_t);
+    }
+  }
+
+  static void write_to(const T& _t, internal::RowBatch* _batch) noexcept {
+    if constexpr (transpilation::has_reflection_method<Type>) {
+      write_to_batch(_t.reflection(), _batch);
+    } else if constexpr (std::is_enum_v<Type>) {
+      _batch->append(rfl::enum_to_string(_t));
+    } else if constexpr (std::is_same_v<Type, bool>) {
+      _batch->append(_t ? "1" : "0");
     } else {
-      return std::to_string(_t);
+      _batch->append_with(max_number_length, [&](char* _begin) {
+        return write_number(_t, _begin, _begin + max_number_length);
+      });
     }
   }
 
@@ -9,6 +9,7 @@
 #include "../dynamic/Type.hpp"
 #include "../transpilation/get_tablename.hpp"
 #include "Parser_base.hpp"
+#include "write_to_batch.hpp"
 
 namespace sqlgen::parsing {
 
@@ -22,11 +23,24 @@ struct Parser<ForeignKey<T, _ForeignTableType, _col_name>> {
     });
   }
 
+  static Result<ForeignKey<T, _ForeignTableType, _col_name>> read(
+      std::optional<std::string>&& _str) noexcept {
+    return Parser<std::remove_cvref_t<T>>::read(std::move(_str))
+        .transform([](auto&& _t) {
+          return ForeignKey<T, _ForeignTableType, _col_name>(std::move(_t));
+        });
+  }
+
   static std::optional<std::string> write(
       const ForeignKey<T, _ForeignTableType, _col_name>& _f) noexcept {
     return Parser<std::remove_cvref_t<T>>::write(_f.value());
   }
 
+  static void write_to(const ForeignKey<T, _ForeignTableType, _col_name>& _f,
+                       internal::RowBatch* _batch) noexcept {
+    write_to_batch(_f.value(), _batch);
+  }
+
   static dynamic::Type to_type() noexcept {
     return Parser<std::remove_cvref_t<T>>::to_type().visit(
         [](auto _t) -> dynamic::Type {
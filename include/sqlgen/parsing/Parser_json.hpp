@@ -8,6 +8,7 @@
 #include "../JSON.hpp"
 #include "../Result.hpp"
 #include "../dynamic/Type.hpp"
+#include "../internal/RowBatch.hpp"
 #include "Parser_base.hpp"
 
 namespace sqlgen::parsing {
@@ -26,6 +27,10 @@ struct Parser<JSON<T>> {
     return rfl::json::write(_j.value());
   }
 
+  static void write_to(const JSON<T>& _j, internal::RowBatch* _batch) noexcept {
+    _batch->append(rfl::json::write(_j.value()));
+  }
+
   static dynamic::Type to_type() noexcept { return dynamic::types::JSON{}; }
 };
 
@@ -8,6 +8,7 @@
 #include "../Result.hpp"
 #include "../dynamic/Type.hpp"
 #include "Parser_base.hpp"
+#include "write_to_batch.hpp"
 
 namespace sqlgen::parsing {
 
@@ -24,6 +25,17 @@ struct Parser<std::optional<T>> {
         });
   }
 
+  static Result<std::optional<T>> read(
+      std::optional<std::string>&& _str) noexcept {
+    if (!_str) {
+      return std::optional<T>();
+    }
+    return Parser<std::remove_cvref_t<T>>::read(std::move(_str))
+        .transform([](auto&& _t) -> std::optional<T> {
+          return std::make_optional<T>(std::move(_t));
+        });
+  }
+
   static std::optional<std::string> write(const std::optional<T>& _o) noexcept {
     if (!_o) {
       return std::nullopt;
@@ -31,6 +43,15 @@ struct Parser<std::optional<T>> {
     return Parser<std::remove_cvref_t<T>>::write(*_o);
   }
 
+  static void write_to(const std::optional<T>& _o,
+                       internal::RowBatch* _batch) noexcept {
+    if (!_o) {
+      _batch->append_null();
+    } else {
+      write_to_batch(*_o, _batch);
+    }
+  }
+
   static dynamic::Type to_type() noexcept {
     return Parser<std::remove_cvref_t<T>>::to_type().visit(
         [](auto _t) -> dynamic::Type {
@@ -8,6 +8,7 @@
 #include "../Result.hpp"
 #include "../dynamic/Type.hpp"
 #include "Parser_base.hpp"
+#include "write_to_batch.hpp"
 
 namespace sqlgen::parsing {
 
@@ -21,6 +22,14 @@ struct Parser<PrimaryKey<T, _auto_incr>> {
         });
   }
 
+  static Result<PrimaryKey<T, _auto_incr>> read(
+      std::optional<std::string>&& _str) noexcept {
+    return Parser<std::remove_cvref_t<T>>::read(std::move(_str))
+        .transform([](auto&& _t) -> PrimaryKey<T, _auto_incr> {
+          return PrimaryKey<T, _auto_incr>(std::move(_t));
+        });
+  }
+
   static std::optional<std::string> write(
       const PrimaryKey<T, _auto_incr>& _p) noexcept {
     if constexpr (_auto_incr) {
@@ -30,6 +39,15 @@ struct Parser<PrimaryKey<T, _auto_incr>> {
     }
   }
 
+  static void write_to(const PrimaryKey<T, _auto_incr>& _p,
+                       internal::RowBatch* _batch) noexcept {
+    if constexpr (_auto_incr) {
+      _batch->append_null();
+    } else {
+      write_to_batch(_p.value(), _batch);
+    }
+  }
+
   static dynamic::Type to_type() noexcept {
     return Parser<std::remove_cvref_t<T>>::to_type().visit(
         [](auto _t) -> dynamic::Type {
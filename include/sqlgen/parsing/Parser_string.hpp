@@ -8,6 +8,7 @@
 #include "../dynamic/Type.hpp"
 #include "../dynamic/types.hpp"
 #include "Parser_base.hpp"
+#include "write_to_batch.hpp"
 
 namespace sqlgen::parsing {
 
@@ -21,10 +22,22 @@ struct Parser<std::string> {
     return *_str;
   }
 
+  static Result<std::string> read(std::optional<std::string>&& _str) noexcept {
+    if (!_str) {
+      return error("NULL value encounted: String value cannot be NULL.");
+    }
+    return std::move(*_str);
+  }
+
   static std::optional<std::string> write(const std::string& _str) noexcept {
     return _str;
   }
 
+  static void write_to(const std::string& _str,
+                       internal::RowBatch* _batch) noexcept {
+    _batch->append(_str);
+  }
+
   static dynamic::Type to_type() noexcept { return dynamic::types::Text{}; }
 };
 
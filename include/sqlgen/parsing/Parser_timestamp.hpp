@@ -8,6 +8,7 @@
 #include "../Timestamp.hpp"
 #include "../dynamic/Type.hpp"
 #include "../dynamic/types.hpp"
+#include "../internal/RowBatch.hpp"
 #include "Parser_base.hpp"
 #include "Parser_default.hpp"
 
@@ -24,10 +25,21 @@ struct Parser<Timestamp<_format>> {
         });
   }
 
+  static Result<TSType> read(std::optional<std::string>&& _str) noexcept {
+    return Parser<std::string>::read(std::move(_str))
+        .and_then([](auto&& _s) -> Result<TSType> {
+          return TSType::from_string(std::move(_s));
+        });
+  }
+
   static std::optional<std::string> write(const TSType& _t) noexcept {
     return Parser<std::string>::write(_t.str());
   }
 
+  static void write_to(const TSType& _t, internal::RowBatch* _batch) noexcept {
+    _batch->append(_t.str());
+  }
+
   static dynamic::Type to_type() noexcept {
     const std::string format = typename TSType::Format().str();
     if (format.find("%z") != std::string::npos) {
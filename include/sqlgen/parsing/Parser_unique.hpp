@@ -8,6 +8,7 @@
 #include "../Unique.hpp"
 #include "../dynamic/Type.hpp"
 #include "Parser_base.hpp"
+#include "write_to_batch.hpp"
 
 namespace sqlgen::parsing {
 
@@ -19,10 +20,20 @@ struct Parser<Unique<T>> {
         [](auto&& _t) { return Unique<T>(std::move(_t)); });
   }
 
+  static Result<Unique<T>> read(std::optional<std::string>&& _str) noexcept {
+    return Parser<std::remove_cvref_t<T>>::read(std::move(_str))
+        .transform([](auto&& _t) { return Unique<T>(std::move(_t)); });
+  }
+
   static std::optional<std::string> write(const Unique<T>& _f) noexcept {
     return Parser<std::remove_cvref_t<T>>::write(_f.value());
   }
 
+  static void write_to(const Unique<T>& _f,
+                       internal::RowBatch* _batch) noexcept {
+    write_to_batch(_f.value(), _batch);
+  }
+
   static dynamic::Type to_type() noexcept {
     return Parser<std::remove_cvref_t<T>>::to_type().visit(
         [](auto _t) -> dynamic::Type {
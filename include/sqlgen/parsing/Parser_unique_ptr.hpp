@@ -8,6 +8,7 @@
 #include "../Result.hpp"
 #include "../dynamic/Type.hpp"
 #include "Parser_base.hpp"
+#include "write_to_batch.hpp"
 
 namespace sqlgen::parsing {
 
@@ -24,6 +25,17 @@ struct Parser<std::unique_ptr<T>> {
         });
   }
 
+  static Result<std::unique_ptr<T>> read(
+      std::optional<std::string>&& _str) noexcept {
+    if (!_str) {
+      return std::unique_ptr<T>();
+    }
+    return Parser<std::remove_cvref_t<T>>::read(std::move(_str))
+        .transform([](auto&& _t) -> std::unique_ptr<T> {
+          return std::make_unique<T>(std::move(_t));
+        });
+  }
+
   static std::optional<std::string> write(
       const std::unique_ptr<T>& _ptr) noexcept {
     if (!_ptr) {
@@ -32,6 +44,15 @@ struct Parser<std::unique_ptr<T>> {
     return Parser<std::remove_cvref_t<T>>::write(*_ptr);
   }
 
+  static void write_to(const std::unique_ptr<T>& _ptr,
+                       internal::RowBatch* _batch) noexcept {
+    if (!_ptr) {
+      _batch->append_null();
+    } else {
+      write_to_batch(*_ptr, _batch);
+    }
+  }
+
   static dynamic::Type to_type() noexcept {
     return Parser<std::remove_cvref_t<T>>::to_type().visit(
         [](auto _t) -> dynamic::Type {
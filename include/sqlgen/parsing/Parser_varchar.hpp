@@ -8,6 +8,7 @@
 #include "../Varchar.hpp"
 #include "../dynamic/Type.hpp"
 #include "../dynamic/types.hpp"
+#include "../internal/RowBatch.hpp"
 #include "Parser_base.hpp"
 #include "Parser_default.hpp"
 
@@ -23,10 +24,23 @@ struct Parser<Varchar<_size>> {
         });
   }
 
+  static Result<Varchar<_size>> read(
+      std::optional<std::string>&& _str) noexcept {
+    return Parser<std::string>::read(std::move(_str))
+        .and_then([](auto&& _t) -> Result<Varchar<_size>> {
+          return Varchar<_size>::make(std::move(_t));
+        });
+  }
+
   static std::optional<std::string> write(const Varchar<_size>& _v) noexcept {
     return Parser<std::string>::write(_v.value());
   }
 
+  static void write_to(const Varchar<_size>& _v,
+                       internal::RowBatch* _batch) noexcept {
+    Parser<std::string>::write_to(_v.value(), _batch);
+  }
+
   static dynamic::Type to_type() noexcept {
     return dynamic::types::VarChar{.length = _size};
   }
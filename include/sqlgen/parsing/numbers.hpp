@@ -0,0 +1,136 @@
+#ifndef SQLGEN_PARSING_NUMBERS_HPP_
+#define SQLGEN_PARSING_NUMBERS_HPP_
+
+#include <array>
+#include <charconv>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <version>
+
+#include "../Result.hpp"
+
+#if !defined(__cpp_lib_to_chars)
+#include <cerrno>
+#include <cstdlib>
+#endif
+
+namespace sqlgen::parsing {
+
+/// from_chars does not accept a leading '+', but some databases emit it.
+inline const char* skip_plus_sign(const char* _begin,
+                                  const char* _end) noexcept {
+  if (_begin != _end && *_begin == '+' && _begin + 1 != _end &&
+      *(_begin + 1) != '-') {
+    return _begin + 1;
+  }
+  return _begin;
+}
+
+/// Databases sometimes return integral values with a zero fraction, such as
+/// "3.000000" for extract(SECOND ...). We accept those, but nothing else.
+inline bool is_zero_fraction(const char* _begin, const char* _end) noexcept {
+  if (_begin == _end || *_begin != '.') {
+    return false;
+  }
+  for (auto it = _begin + 1; it != _end; ++it) {
+    if (*it != '0') {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class T>
+Result<T> read_integral(const std::string_view _str) {
+  static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>);
+  const auto end = _str.data() + _str.size();
+  T value{};
+  const auto [ptr, ec] =
+      std::from_chars(skip_plus_sign(_str.data(), end), end, value);
+  if (ec == std::errc::result_out_of_range) [[unlikely]] {
+    return error("Value '" + std::string(_str) + "' is out of range for a " +
+                 std::to_string(sizeof(T) * 8) + "-bit " +
+                 (std::is_signed_v<T> ? "signed" : "unsigned") + " integer.");
+  }
+  if (ec != std::errc() || (ptr != end && !is_zero_fraction(ptr, end)))
+      [[unlikely]] {
+    return error("Could not parse '" + std::string(_str) +
+                 "' as an integer.");
+  }
+  return value;
+}
+
+template <class T>
+Result<T> read_floating_point(const std::string_view _str) {
+  static_assert(std::is_floating_point_v<T>);
+  const auto begin = skip_plus_sign(_str.data(), _str.data() + _str.size());
+  const auto end = _str.data() + _str.size();
+  T value{};
+#if defined(__cpp_lib_to_chars)
+  const auto [ptr, ec] = std::from_chars(begin, end, value);
+  const bool out_of_range = ec == std::errc::result_out_of_range;
+  const bool failed = ec != std::errc() || ptr != end;
+#else
+  // Fallback for standard libraries without floating point from_chars.
+  const auto str = std::string(begin, end);
+  char* ptr = nullptr;
+  errno = 0;
+  if constexpr (std::is_same_v<T, float>) {
+    value = std::strtof(str.c_str(), &ptr);
+  } else if constexpr (std::is_same_v<T, double>) {
+    value = std::strtod(str.c_str(), &ptr);
+  } else {
+    value = std::strtold(str.c_str(), &ptr);
+  }
+  const bool out_of_range = errno == ERANGE;
+  const bool failed =
+      str.empty() || ptr != str.c_str() + str.size() || out_of_range;
+#endif
+  if (out_of_range) [[unlikely]] {
+    return error("Value '" + std::string(_str) +
+                 "' is out of range for a floating point number.");
+  }
+  if (failed) [[unlikely]] {
+    return error("Could not parse '" + std::string(_str) +
+                 "' as a floating point number.");
+  }
+  return value;
+}
+
+/// The maximum number of characters write_number(...) produces.
+inline constexpr size_t max_number_length = 64;
+
+/// Writes _t to [_begin, _end) and returns a pointer one past the last
+/// character written. The range must hold at least max_number_length chars.
+template <class T>
+char* write_number(const T _t, char* _begin, char* _end) noexcept {
+  static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>);
+  if constexpr (std::is_integral_v<T>) {
+    return std::to_chars(_begin, _end, _t).ptr;
+  } else {
+#if defined(__cpp_lib_to_chars)
+    // The shortest representation that round-trips exactly.
+    return std::to_chars(_begin, _end, _t).ptr;
+#else
+    const auto n = std::snprintf(_begin, static_cast<size_t>(_end - _begin),
+                                 "%.*Lg", std::numeric_limits<T>::max_digits10,
+                                 static_cast<long double>(_t));
+    return _begin + n;
+#endif
+  }
+}
+
+template <class T>
+std::string write_number(const T _t) {
+  std::array<char, max_number_length> buf;
+  return std::string(buf.data(),
+                     write_number(_t, buf.data(), buf.data() + buf.size()));
+}
+
+}  // namespace sqlgen::parsing
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef SQLGEN_PARSING_WRITE_TO_BATCH_HPP_
+#define SQLGEN_PARSING_WRITE_TO_BATCH_HPP_
+
+#include <type_traits>
+
+#include "../internal/RowBatch.hpp"
+#include "Parser_base.hpp"
+
+namespace sqlgen::parsing {
+
+/// Whether Parser<T> can append its string representation to a RowBatch
+/// directly, without going through a temporary std::string.
+template <class T>
+concept has_write_to = requires(const T& _t, internal::RowBatch* _batch) {
+  Parser<T>::write_to(_t, _batch);
+};
+
+/// Appends the string representation of _t to _batch as a new cell. Parsers
+/// that do not implement write_to(...), such as user-defined ones, fall back
+/// to write(...).
+template <class T>
+void write_to_batch(const T& _t, internal::RowBatch* _batch) noexcept {
+  using Type = std::remove_cvref_t<T>;
+  if constexpr (has_write_to<Type>) {
+    Parser<Type>::write_to(_t, _batch);
+  } else {
+    const auto str = Parser<Type>::write(_t);
+    if (str) {
+      _batch->append(*str);
+    } else {
+      _batch->append_null();
+    }
+  }
+}
+
+}  // namespace sqlgen::parsing
+
+#endif
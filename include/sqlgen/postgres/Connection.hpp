@@ -7,6 +7,7 @@
 #include <rfl.hpp>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 
 #include "../Iterator.hpp"
 #include "../Ref.hpp"
@@ -15,6 +16,9 @@
 #include "../dynamic/Column.hpp"
 #include "../dynamic/Statement.hpp"
 #include "../dynamic/Write.hpp"
+#include "../internal/ReadOptions.hpp"
+#include "../internal/WriteOptions.hpp"
+#include "../internal/RowBatch.hpp"
 #include "../internal/to_container.hpp"
 #include "../internal/write_or_insert.hpp"
 #include "../is_connection.hpp"
@@ -27,6 +31,9 @@
 
 namespace sqlgen::postgres {
 
+/// The channel on which writes are announced to InvalidationListeners.
+inline constexpr std::string_view INVALIDATION_CHANNEL = "sqlgen_invalidate";
+
 class SQLGEN_API Connection {
   using ConnPtr = Ref<PGconn>;
 
@@ -45,57 +52,90 @@ class SQLGEN_API Connection {
   Result<Nothing> execute(const std::string& _sql) noexcept;
 
   template <class ItBegin, class ItEnd>
-  Result<Nothing> insert(const dynamic::Insert& _stmt, ItBegin _begin,
-                         ItEnd _end) noexcept {
+  Result<Nothing> insert(
+      const dynamic::Insert& _stmt, ItBegin _begin, ItEnd _end,
+      const internal::WriteOptions& _options =
+          internal::WriteOptions{}) noexcept {
+    return insert(postgres::to_sql_impl(_stmt), _begin, _end, _options);
+  }
+
+  /// Inserts data using an INSERT statement that has already been transpiled.
+  template <class ItBegin, class ItEnd>
+  Result<Nothing> insert(
+      const std::string& _sql, ItBegin _begin, ItEnd _end,
+      const internal::WriteOptions& _options =
+          internal::WriteOptions{}) noexcept {
     return internal::write_or_insert(
-        [&](const auto& _data) { return insert_impl(_stmt, _data); }, _begin,
-        _end);
+        [&](const auto& _data) { return insert_impl(_sql, _data); }, _begin,
+        _end, _options);
+  }
+
+  template <class ContainerType>
+  auto read(const dynamic::SelectFrom& _query,
+            const internal::ReadOptions& _options = internal::ReadOptions{}) {
+    return read<ContainerType>(postgres::to_sql_impl(_query), _options);
   }
 
+  /// Reads the results of a SELECT statement that has already been
+  /// transpiled.
   template <class ContainerType>
-  auto read(const dynamic::SelectFrom& _query) {
+  auto read(const std::string& _sql,
+            const internal::ReadOptions& _options = internal::ReadOptions{}) {
     using ValueType = transpilation::value_t<ContainerType>;
     return internal::to_container<ContainerType>(
-        read_impl(_query).transform([](auto&& _it) {
+        read_impl(_sql, _options).transform([&](auto&& _it) {
           return sqlgen::Iterator<ValueType, postgres::Iterator>(
-              std::move(_it));
+              std::move(_it), _options);
         }));
   }
 
+  /// Tells the InvalidationListeners of other processes that _table has
+  /// been written to, if credentials.notify_invalidation is set. Inside of a
+  /// transaction, the notification is only delivered on commit.
+  Result<Nothing> notify_invalidation(const std::string& _table) noexcept;
+
   Result<Nothing> rollback() noexcept;
 
-  std::string to_sql(const dynamic::Statement& _stmt) noexcept;
+  static std::string to_sql(const dynamic::Statement& _stmt) noexcept;
 
   Result<Nothing> start_write(const dynamic::Write& _stmt);
 
+  /// Starts a write operation using a statement that has already been
+  /// transpiled.
+  Result<Nothing> start_write(const std::string& _sql);
+
   Result<Nothing> end_write();
 
   template <class ItBegin, class ItEnd>
-  Result<Nothing> write(ItBegin _begin, ItEnd _end) {
+  Result<Nothing> write(
+      ItBegin _begin, ItEnd _end,
+      const internal::WriteOptions& _options = internal::WriteOptions{}) {
     return internal::write_or_insert(
-        [&](const auto& _data) { return write_impl(_data); }, _begin, _end);
+        [&](const auto& _data) { return write_impl(_data); }, _begin, _end,
+        _options);
   }
 
  private:
-  Result<Nothing> insert_impl(
-      const dynamic::Insert& _stmt,
-      const std::vector<std::vector<std::optional<std::string>>>&
-          _data) noexcept;
+  Result<Nothing> insert_impl(const std::string& _sql,
+                              const internal::RowBatch& _data) noexcept;
 
   static ConnPtr make_conn(const std::string& _conn_str);
 
-  Result<Ref<Iterator>> read_impl(const dynamic::SelectFrom& _query);
+  Result<Ref<Iterator>> read_impl(const std::string& _sql,
+                                  const internal::ReadOptions& _options);
 
-  std::string to_buffer(
-      const std::vector<std::optional<std::string>>& _line) const noexcept;
+  void to_buffer(const internal::RowBatch::Row& _line,
+                 std::string* _buffer) const noexcept;
 
-  Result<Nothing> write_impl(
-      const std::vector<std::vector<std::optional<std::string>>>& _data);
+  Result<Nothing> write_impl(const internal::RowBatch& _data);
 
  private:
   ConnPtr conn_;
 
   Credentials credentials_;
+
+  /// The cursors that are open on conn_.
+  Ref<Iterator::Cursors> cursors_;
 };
 
 static_assert(is_connection<Connection>,
@@ -12,6 +12,11 @@ struct Credentials {
   std::string dbname;
   int port = 5432;
 
+  /// Whether writes through sqlgen send a notification on the
+  /// sqlgen_invalidate channel, so that the caches of other processes can be
+  /// invalidated using an InvalidationListener.
+  bool notify_invalidation = false;
+
   std::string to_str() const {
     return "postgresql://" + user + ":" + password + "@" + host + ":" +
            std::to_string(port) + "/" + dbname;
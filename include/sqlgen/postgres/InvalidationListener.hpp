@@ -0,0 +1,82 @@
+#ifndef SQLGEN_POSTGRES_INVALIDATIONLISTENER_HPP_
+#define SQLGEN_POSTGRES_INVALIDATIONLISTENER_HPP_
+
+#include <libpq-fe.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "../Ref.hpp"
+#include "../Result.hpp"
+#include "../sqlgen_api.hpp"
+#include "Credentials.hpp"
+
+namespace sqlgen::postgres {
+
+/// Listens on the sqlgen_invalidate channel on a connection of its own and
+/// invalidates the cached results of every table another process announces
+/// a write to. Writes are only announced by connections that have
+/// credentials.notify_invalidation set. The listener stops, when it is
+/// destroyed.
+class SQLGEN_API InvalidationListener {
+  using ConnPtr = Ref<PGconn>;
+
+  /// How long the listener waits for notifications, before it checks whether
+  /// it should stop.
+  static constexpr auto POLL_INTERVAL = std::chrono::milliseconds(100);
+
+  /// How long the listener waits between attempts to reconnect.
+  static constexpr auto RECONNECT_INTERVAL = std::chrono::seconds(1);
+
+ public:
+  InvalidationListener(const Credentials& _credentials);
+
+  static Result<Ref<InvalidationListener>> make(
+      const Credentials& _credentials) noexcept;
+
+  InvalidationListener(const InvalidationListener& _other) = delete;
+
+  ~InvalidationListener();
+
+  InvalidationListener& operator=(const InvalidationListener& _other) = delete;
+
+ private:
+  /// Waits for notifications until the listener is stopped.
+  void listen();
+
+  /// Connects to the database and subscribes to the channel.
+  static ConnPtr make_conn(const std::string& _conn_str);
+
+  /// Reads the notifications that have arrived and invalidates their tables.
+  void process_notifications();
+
+  /// Tries to reestablish a lost connection. All cached results are
+  /// invalidated afterwards, because notifications might have been missed in
+  /// the meantime.
+  void reconnect();
+
+  /// Waits until there is something to read on conn_, but not longer than
+  /// POLL_INTERVAL.
+  void wait_for_input();
+
+ private:
+  ConnPtr conn_;
+
+  /// Whether the listener is shutting down.
+  std::atomic<bool> stopped_;
+
+  /// The thread that waits for notifications.
+  std::thread thread_;
+};
+
+/// Starts listening for the writes announced by other processes, as long as
+/// the returned listener is kept alive.
+inline auto listen_for_invalidations(const Credentials& _credentials) {
+  return InvalidationListener::make(_credentials);
+}
+
+}  // namespace sqlgen::postgres
+
+#endif
@@ -3,6 +3,7 @@
 
 #include <libpq-fe.h>
 
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <string>
@@ -10,6 +11,7 @@
 
 #include "../Ref.hpp"
 #include "../Result.hpp"
+#include "../internal/RowBatch.hpp"
 #include "../sqlgen_api.hpp"
 
 namespace sqlgen::postgres {
@@ -17,8 +19,31 @@ namespace sqlgen::postgres {
 class SQLGEN_API Iterator {
   using ConnPtr = Ref<PGconn>;
 
+  /// The number of rows fetched to estimate the size of a row, when there is a
+  /// byte limit.
+  static constexpr size_t NUM_ROWS_TO_ESTIMATE = 100;
+
  public:
-  Iterator(const std::string& _sql, const ConnPtr& _conn);
+  /// Keeps track of the cursors that are open on a connection. Cursors only
+  /// exist inside a transaction. If there is none, the first cursor begins
+  /// one, which must then be kept open until the last cursor is closed.
+  struct Cursors {
+    /// The number of cursors that are currently open.
+    size_t num_open = 0;
+
+    /// Whether the transaction was begun by the cursors and therefore needs
+    /// to be ended by them.
+    bool owns_transaction = false;
+  };
+
+  Iterator(const std::string& _sql, const ConnPtr& _conn,
+           const Ref<Cursors>& _cursors);
+
+  /// Serves the batches from a complete result, which has been fetched in a
+  /// single round trip. For small results, this is much cheaper than setting
+  /// up a cursor.
+  Iterator(const Ref<PGresult>& _res, const ConnPtr& _conn,
+           const Ref<Cursors>& _cursors);
 
   Iterator(const Iterator& _other) = delete;
 
@@ -31,33 +56,56 @@ class SQLGEN_API Iterator {
 
   /// Returns the next batch of rows.
   /// If _batch_size is greater than the number of rows left, returns all
-  /// of the rows left.
-  Result<std::vector<std::vector<std::optional<std::string>>>> next(
-      const size_t _batch_size);
+  /// of the rows left. If _batch_bytes is not 0, the batch is cut off early,
+  /// once its cells take up at least _batch_bytes bytes.
+  /// Postgres can only fetch a fixed number of rows, so the byte limit is
+  /// approximated based on the size of the rows fetched so far.
+  Result<internal::RowBatch> next(const size_t _batch_size,
+                                  const size_t _batch_bytes = 0);
 
   Iterator& operator=(const Iterator& _other) = delete;
 
   Iterator& operator=(Iterator&& _other) noexcept;
 
  private:
+  /// Generates a name that is unique within the process, so that several
+  /// cursors can be open on the same connection.
   static std::string make_cursor_name() {
-    // TODO: Create unique cursor names.
-    return "sqlgen_cursor";
+    static std::atomic<uint64_t> num_cursors = 0;
+    return "sqlgen_cursor_" + std::to_string(++num_cursors);
   }
 
   /// Shuts the iterator down.
   void shutdown();
 
+  /// Copies the rows [_begin, _end) of _res into a batch.
+  static internal::RowBatch to_batch(const Ref<PGresult>& _res,
+                                     const int _begin, const int _end);
+
  private:
-  /// A unique name to identify the cursor.
+  /// A unique name to identify the cursor. This is empty, if the iterator
+  /// was created from a complete result.
   std::string cursor_name_;
 
+  /// The complete result, if the iterator was created from one.
+  std::optional<Ref<PGresult>> res_;
+
+  /// The next row to be returned from res_.
+  int row_;
+
   /// The underlying postgres connection. We have this in here to prevent its
   /// destruction for the lifetime of the iterator.
   ConnPtr conn_;
 
+  /// The cursors that are open on conn_.
+  Ref<Cursors> cursors_;
+
   /// Whether the end is reached.
   bool end_;
+
+  /// The average size of the rows fetched so far, or 0, if no rows have been
+  /// fetched yet.
+  size_t bytes_per_row_;
 };
 
 }  // namespace sqlgen::postgres
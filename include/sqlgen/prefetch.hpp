@@ -0,0 +1,12 @@
+#ifndef SQLGEN_PREFETCH_HPP_
+#define SQLGEN_PREFETCH_HPP_
+
+namespace sqlgen {
+
+struct Prefetch {};
+
+inline const auto prefetch = Prefetch{};
+
+}  // namespace sqlgen
+
+#endif
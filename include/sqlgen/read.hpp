@@ -6,10 +6,15 @@
 
 #include "Ref.hpp"
 #include "Result.hpp"
+#include "batch_size.hpp"
+#include "internal/ReadOptions.hpp"
 #include "internal/is_range.hpp"
+#include "internal/static_sql.hpp"
 #include "is_connection.hpp"
 #include "limit.hpp"
 #include "order_by.hpp"
+#include "parallel_decode.hpp"
+#include "prefetch.hpp"
 #include "transpilation/order_by_t.hpp"
 #include "transpilation/read_to_select_from.hpp"
 #include "transpilation/value_t.hpp"
@@ -21,22 +26,30 @@ template <class ContainerType, class WhereType, class OrderByType,
           class LimitType, class Connection>
   requires is_connection<Connection>
 auto read_impl(const Ref<Connection>& _conn, const WhereType& _where,
-               const LimitType& _limit) {
+               const LimitType& _limit, const internal::ReadOptions& _options) {
   using ValueType = transpilation::value_t<ContainerType>;
-  const auto query =
-      transpilation::read_to_select_from<ValueType, WhereType, OrderByType,
-                                         LimitType>(_where, _limit);
-  return _conn->template read<ContainerType>(query);
+  if constexpr (std::is_same_v<WhereType, Nothing> &&
+                std::is_same_v<LimitType, Nothing>) {
+    return _conn->template read<ContainerType>(
+        internal::read_sql<ValueType, OrderByType,
+                           internal::dialect_t<Connection>>(),
+        _options);
+  } else {
+    const auto query =
+        transpilation::read_to_select_from<ValueType, WhereType, OrderByType,
+                                           LimitType>(_where, _limit);
+    return _conn->template read<ContainerType>(query, _options);
+  }
 }
 
 template <class ContainerType, class WhereType, class OrderByType,
           class LimitType, class Connection>
   requires is_connection<Connection>
 auto read_impl(const Result<Ref<Connection>>& _res, const WhereType& _where,
-               const LimitType& _limit) {
+               const LimitType& _limit, const internal::ReadOptions& _options) {
   return _res.and_then([&](const auto& _conn) {
     return read_impl<ContainerType, WhereType, OrderByType, LimitType>(
-        _conn, _where, _limit);
+        _conn, _where, _limit, _options);
   });
 }
 
@@ -46,12 +59,15 @@ struct Read {
   auto operator()(const auto& _conn) const {
     if constexpr (std::ranges::input_range<std::remove_cvref_t<Type>> ||
                   internal::is_range_v<Type>) {
-      return read_impl<Type, WhereType, OrderByType, LimitType>(_conn, where_,
-                                                                limit_);
+      return read_impl<Type, WhereType, OrderByType, LimitType>(
+          _conn, where_, limit_, internal::apply_limit(options_, limit_));
 
     } else {
+      // We expect exactly one result.
+      auto options = options_;
+      options.small_result = true;
       return read_impl<std::vector<Type>, WhereType, OrderByType, LimitType>(
-                 _conn, where_, limit_)
+                 _conn, where_, limit_, options)
           .and_then([](auto&& _vec) -> Result<Type> {
             if (_vec.size() != 1) {
               return error(
@@ -74,7 +90,7 @@ struct Read {
     static_assert(std::is_same_v<LimitType, Nothing>,
                   "You cannot call limit(...) before where(...).");
     return Read<Type, ConditionType, OrderByType, LimitType>{
-        .where_ = _where.condition};
+        .where_ = _where.condition, .options_ = _r.options_};
   }
 
   template <class... ColTypes>
@@ -91,19 +107,52 @@ struct Read {
                 transpilation::order_by_t<
                     transpilation::value_t<Type>, Nothing,
                     typename std::remove_cvref_t<ColTypes>::ColType...>,
-                LimitType>{.where_ = _r.where_};
+                LimitType>{.where_ = _r.where_, .options_ = _r.options_};
   }
 
   friend auto operator|(const Read& _r, const Limit& _limit) {
     static_assert(std::is_same_v<LimitType, Nothing>,
                   "You cannot call limit(...) twice.");
-    return Read<Type, WhereType, OrderByType, Limit>{.where_ = _r.where_,
-                                                     .limit_ = _limit};
+    return Read<Type, WhereType, OrderByType, Limit>{
+        .where_ = _r.where_, .limit_ = _limit, .options_ = _r.options_};
+  }
+
+  friend auto operator|(const Read& _r, const Prefetch&) {
+    auto r = _r;
+    r.options_.prefetch = true;
+    return r;
+  }
+
+  friend auto operator|(const Read& _r, const ParallelDecode& _p) {
+    auto r = _r;
+    r.options_.decode_threads = _p.num_threads;
+    return r;
+  }
+
+  friend auto operator|(const Read& _r, const BatchSize& _b) {
+    auto r = _r;
+    r.options_.batch_size = _b.val;
+    return r;
+  }
+
+  friend auto operator|(const Read& _r, const BatchBytes& _b) {
+    auto r = _r;
+    r.options_.batch_bytes = _b.val;
+    return r;
+  }
+
+  friend auto operator|(const Read& _r, const AdaptiveBatchSize& _a) {
+    auto r = _r;
+    r.options_.initial_batch_size = _a.initial;
+    r.options_.batch_growth = _a.growth;
+    return r;
   }
 
   WhereType where_;
 
   LimitType limit_;
+
+  internal::ReadOptions options_;
 };
 
 template <class ContainerType>
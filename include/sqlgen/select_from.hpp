@@ -8,16 +8,21 @@
 #include "Range.hpp"
 #include "Ref.hpp"
 #include "Result.hpp"
+#include "batch_size.hpp"
 #include "col.hpp"
 #include "dynamic/Join.hpp"
 #include "dynamic/SelectFrom.hpp"
 #include "group_by.hpp"
 #include "internal/GetColType.hpp"
+#include "internal/NodeArena.hpp"
+#include "internal/ReadOptions.hpp"
 #include "internal/is_range.hpp"
 #include "internal/iterator_t.hpp"
 #include "is_connection.hpp"
 #include "limit.hpp"
 #include "order_by.hpp"
+#include "parallel_decode.hpp"
+#include "prefetch.hpp"
 #include "to.hpp"
 #include "transpilation/Join.hpp"
 #include "transpilation/TableWrapper.hpp"
@@ -40,14 +45,15 @@ template <class TableTupleType, class AliasType, class FieldsType,
 auto select_from_impl(const Ref<Connection>& _conn, const FieldsType& _fields,
                       const TableOrQueryType& _table_or_query,
                       const JoinsType& _joins, const WhereType& _where,
-                      const LimitType& _limit) {
+                      const LimitType& _limit,
+                      const internal::ReadOptions& _options) {
   if constexpr (internal::is_range_v<ContainerType>) {
     const auto query =
         transpilation::to_select_from<TableTupleType, AliasType, FieldsType,
                                       TableOrQueryType, JoinsType, WhereType,
                                       GroupByType, OrderByType, LimitType>(
             _fields, _table_or_query, _joins, _where, _limit);
-    return _conn->template read<ContainerType>(query);
+    return _conn->template read<ContainerType>(query, _options);
 
   } else {
     const auto to_container = [](auto range) -> Result<ContainerType> {
@@ -73,7 +79,8 @@ auto select_from_impl(const Ref<Connection>& _conn, const FieldsType& _fields,
     return select_from_impl<TableTupleType, AliasType, FieldsType,
                             TableOrQueryType, JoinsType, WhereType, GroupByType,
                             OrderByType, LimitType, RangeType>(
-               _conn, _fields, _table_or_query, _joins, _where, _limit)
+               _conn, _fields, _table_or_query, _joins, _where, _limit,
+               _options)
         .and_then(to_container);
   }
 }
@@ -87,12 +94,13 @@ auto select_from_impl(const Result<Ref<Connection>>& _res,
                       const FieldsType& _fields,
                       const TableOrQueryType& _table_or_query,
                       const JoinsType& _joins, const WhereType& _where,
-                      const LimitType& _limit) {
+                      const LimitType& _limit,
+                      const internal::ReadOptions& _options) {
   return _res.and_then([&](const auto& _conn) {
     return select_from_impl<TableTupleType, AliasType, FieldsType,
                             TableOrQueryType, JoinsType, WhereType, GroupByType,
                             OrderByType, LimitType, ContainerType>(
-        _conn, _fields, _table_or_query, _joins, _where, _limit);
+        _conn, _fields, _table_or_query, _joins, _where, _limit, _options);
   });
 }
 
@@ -116,7 +124,8 @@ struct SelectFrom {
       return select_from_impl<
           TableTupleType, AliasType, FieldsType, TableOrQueryType, JoinsType,
           WhereType, GroupByType, OrderByType, LimitType, ContainerType>(
-          _conn, fields_, from_, joins_, where_, limit_);
+          _conn, fields_, from_, joins_, where_, limit_,
+          internal::apply_limit(options_, limit_));
 
     } else {
       const auto extract_result = [](auto&& _vec) -> Result<ToType> {
@@ -129,11 +138,14 @@ struct SelectFrom {
         return std::move(_vec[0]);
       };
 
+      // We expect exactly one result.
+      auto options = options_;
+      options.small_result = true;
       return select_from_impl<TableTupleType, AliasType, FieldsType,
                               TableOrQueryType, JoinsType, WhereType,
                               GroupByType, OrderByType, LimitType,
                               std::vector<std::remove_cvref_t<ToType>>>(
-                 _conn, fields_, from_, joins_, where_, limit_)
+                 _conn, fields_, from_, joins_, where_, limit_, options)
           .and_then(extract_result);
     }
   }
@@ -164,7 +176,8 @@ struct SelectFrom {
                         WhereType, GroupByType, OrderByType, LimitType, ToType>{
           .fields_ = _s.fields_,
           .from_ = _s.from_,
-          .joins_ = NewJoinsType(_join)};
+          .joins_ = NewJoinsType(_join),
+          .options_ = _s.options_};
 
     } else {
       using TupleType =
@@ -177,7 +190,10 @@ struct SelectFrom {
 
       return SelectFrom<TableOrQueryType, AliasType, FieldsType, NewJoinsType,
                         WhereType, GroupByType, OrderByType, LimitType, ToType>{
-          .fields_ = _s.fields_, .from_ = _s.from_, .joins_ = joins};
+          .fields_ = _s.fields_,
+          .from_ = _s.from_,
+          .joins_ = joins,
+          .options_ = _s.options_};
     }
   }
 
@@ -200,7 +216,8 @@ struct SelectFrom {
                       ToType>{.fields_ = _s.fields_,
                               .from_ = _s.from_,
                               .joins_ = _s.joins_,
-                              .where_ = _where.condition};
+                              .where_ = _where.condition,
+                              .options_ = _s.options_};
   }
 
   template <class... ColTypes>
@@ -226,7 +243,8 @@ struct SelectFrom {
                       OrderByType, LimitType, ToType>{.fields_ = _s.fields_,
                                                       .from_ = _s.from_,
                                                       .joins_ = _s.joins_,
-                                                      .where_ = _s.where_};
+                                                      .where_ = _s.where_,
+                                                      .options_ = _s.options_};
   }
 
   template <class... ColTypes>
@@ -254,7 +272,8 @@ struct SelectFrom {
                       ToType>{.fields_ = _s.fields_,
                               .from_ = _s.from_,
                               .joins_ = _s.joins_,
-                              .where_ = _s.where_};
+                              .where_ = _s.where_,
+                              .options_ = _s.options_};
   }
 
   friend auto operator|(const SelectFrom& _s, const Limit& _limit) {
@@ -266,7 +285,8 @@ struct SelectFrom {
         .from_ = _s.from_,
         .joins_ = _s.joins_,
         .where_ = _s.where_,
-        .limit_ = _limit};
+        .limit_ = _limit,
+        .options_ = _s.options_};
   }
 
   template <class NewToType>
@@ -279,7 +299,39 @@ struct SelectFrom {
                                  .from_ = _s.from_,
                                  .joins_ = _s.joins_,
                                  .where_ = _s.where_,
-                                 .limit_ = _s.limit_};
+                                 .limit_ = _s.limit_,
+                                 .options_ = _s.options_};
+  }
+
+  friend auto operator|(const SelectFrom& _s, const Prefetch&) {
+    auto s = _s;
+    s.options_.prefetch = true;
+    return s;
+  }
+
+  friend auto operator|(const SelectFrom& _s, const ParallelDecode& _p) {
+    auto s = _s;
+    s.options_.decode_threads = _p.num_threads;
+    return s;
+  }
+
+  friend auto operator|(const SelectFrom& _s, const BatchSize& _b) {
+    auto s = _s;
+    s.options_.batch_size = _b.val;
+    return s;
+  }
+
+  friend auto operator|(const SelectFrom& _s, const BatchBytes& _b) {
+    auto s = _s;
+    s.options_.batch_bytes = _b.val;
+    return s;
+  }
+
+  friend auto operator|(const SelectFrom& _s, const AdaptiveBatchSize& _a) {
+    auto s = _s;
+    s.options_.initial_batch_size = _a.initial;
+    s.options_.batch_growth = _a.growth;
+    return s;
   }
 
   FieldsType fields_;
@@ -291,6 +343,8 @@ struct SelectFrom {
   WhereType where_;
 
   LimitType limit_;
+
+  internal::ReadOptions options_;
 };
 
 namespace transpilation {
@@ -313,7 +367,7 @@ struct ToTableOrQuery<
   dynamic::SelectFrom::TableOrQueryType operator()(const auto& _query) {
     using TableTupleType =
         table_tuple_t<TableOrQueryType, AliasType, JoinsType>;
-    return Ref<dynamic::SelectFrom>::make(
+    return sqlgen::internal::make_node<dynamic::SelectFrom>(
         transpilation::to_select_from<TableTupleType, AliasType, FieldsType,
                                       TableOrQueryType, JoinsType, WhereType,
                                       GroupByType, OrderByType, LimitType>(
@@ -14,6 +14,9 @@
 #include "../Result.hpp"
 #include "../Transaction.hpp"
 #include "../dynamic/Write.hpp"
+#include "../internal/ReadOptions.hpp"
+#include "../internal/WriteOptions.hpp"
+#include "../internal/RowBatch.hpp"
 #include "../internal/to_container.hpp"
 #include "../internal/write_or_insert.hpp"
 #include "../is_connection.hpp"
@@ -42,34 +45,62 @@ class SQLGEN_API Connection {
   Result<Nothing> execute(const std::string& _sql) noexcept;
 
   template <class ItBegin, class ItEnd>
-  Result<Nothing> insert(const dynamic::Insert& _stmt, ItBegin _begin,
-                         ItEnd _end) noexcept {
+  Result<Nothing> insert(
+      const dynamic::Insert& _stmt, ItBegin _begin, ItEnd _end,
+      const internal::WriteOptions& _options =
+          internal::WriteOptions{}) noexcept {
+    return insert(sqlite::to_sql_impl(_stmt), _begin, _end, _options);
+  }
+
+  /// Inserts data using an INSERT statement that has already been transpiled.
+  template <class ItBegin, class ItEnd>
+  Result<Nothing> insert(
+      const std::string& _sql, ItBegin _begin, ItEnd _end,
+      const internal::WriteOptions& _options =
+          internal::WriteOptions{}) noexcept {
     return internal::write_or_insert(
-        [&](const auto& _data) { return insert_impl(_stmt, _data); }, _begin,
-        _end);
+        [&](const auto& _data) { return insert_impl(_sql, _data); }, _begin,
+        _end, _options);
   }
 
   template <class ContainerType>
-  auto read(const dynamic::SelectFrom& _query) {
+  auto read(const dynamic::SelectFrom& _query,
+            const internal::ReadOptions& _options = internal::ReadOptions{}) {
+    return read<ContainerType>(sqlite::to_sql_impl(_query), _options);
+  }
+
+  /// Reads the results of a SELECT statement that has already been
+  /// transpiled.
+  template <class ContainerType>
+  auto read(const std::string& _sql,
+            const internal::ReadOptions& _options = internal::ReadOptions{}) {
     using ValueType = transpilation::value_t<ContainerType>;
     return internal::to_container<ContainerType>(
-        read_impl(_query).transform([](auto&& _it) {
-          return sqlgen::Iterator<ValueType, sqlite::Iterator>(std::move(_it));
+        read_impl(_sql).transform([&](auto&& _it) {
+          return sqlgen::Iterator<ValueType, sqlite::Iterator>(std::move(_it),
+                                                               _options);
         }));
   }
 
   Result<Nothing> rollback() noexcept;
 
-  std::string to_sql(const dynamic::Statement& _stmt) noexcept;
+  static std::string to_sql(const dynamic::Statement& _stmt) noexcept;
 
   Result<Nothing> start_write(const dynamic::Write& _stmt);
 
+  /// Starts a write operation using a statement that has already been
+  /// transpiled.
+  Result<Nothing> start_write(const std::string& _sql);
+
   Result<Nothing> end_write();
 
   template <class ItBegin, class ItEnd>
-  Result<Nothing> write(ItBegin _begin, ItEnd _end) {
+  Result<Nothing> write(
+      ItBegin _begin, ItEnd _end,
+      const internal::WriteOptions& _options = internal::WriteOptions{}) {
     return internal::write_or_insert(
-        [&](const auto& _data) { return write_impl(_data); }, _begin, _end);
+        [&](const auto& _data) { return write_impl(_data); }, _begin, _end,
+        _options);
   }
 
  private:
@@ -78,25 +109,21 @@ class SQLGEN_API Connection {
 
   /// Actually inserts data based on a prepared statement -
   /// used by both .insert(...) and .write(...).
-  Result<Nothing> actual_insert(
-      const std::vector<std::vector<std::optional<std::string>>>& _data,
-      sqlite3_stmt* _stmt) const noexcept;
+  Result<Nothing> actual_insert(const internal::RowBatch& _data,
+                                sqlite3_stmt* _stmt) const noexcept;
 
   /// Implements the actual insert.
-  Result<Nothing> insert_impl(
-      const dynamic::Insert& _stmt,
-      const std::vector<std::vector<std::optional<std::string>>>&
-          _data) noexcept;
+  Result<Nothing> insert_impl(const std::string& _sql,
+                              const internal::RowBatch& _data) noexcept;
 
   /// Generates a prepared statment, usually for inserts.
   Result<StmtPtr> prepare_statement(const std::string& _sql) const noexcept;
 
   /// Implements the actual read.
-  Result<Ref<Iterator>> read_impl(const dynamic::SelectFrom& _query);
+  Result<Ref<Iterator>> read_impl(const std::string& _sql);
 
   /// Implements the actual write
-  Result<Nothing> write_impl(
-      const std::vector<std::vector<std::optional<std::string>>>& _data);
+  Result<Nothing> write_impl(const internal::RowBatch& _data);
 
  private:
   /// A prepared statement - needed for the read and write operations. Note that
@@ -9,6 +9,7 @@
 
 #include "../Ref.hpp"
 #include "../Result.hpp"
+#include "../internal/RowBatch.hpp"
 #include "../sqlgen_api.hpp"
 
 namespace sqlgen::sqlite {
@@ -27,9 +28,10 @@ class SQLGEN_API Iterator {
 
   /// Returns the next batch of rows.
   /// If _batch_size is greater than the number of rows left, returns all
-  /// of the rows left.
-  Result<std::vector<std::vector<std::optional<std::string>>>> next(
-      const size_t _batch_size);
+  /// of the rows left. If _batch_bytes is not 0, the batch is cut off early,
+  /// once its cells take up at least _batch_bytes bytes.
+  Result<internal::RowBatch> next(const size_t _batch_size,
+                                  const size_t _batch_bytes = 0);
 
  private:
   void step() { end_ = (sqlite3_step(stmt_.get()) != SQLITE_ROW); }
@@ -8,6 +8,7 @@
 #include "../Literal.hpp"
 #include "../Result.hpp"
 #include "../dynamic/SelectFrom.hpp"
+#include "../internal/NodeArena.hpp"
 #include "../parsing/Parser.hpp"
 #include "Aggregation.hpp"
 #include "AggregationOp.hpp"
@@ -165,7 +166,7 @@ struct MakeField<TableTupleType, Aggregation<_agg, ValueType>> {
     using DynamicAggregationType = dynamic_aggregation_t<_agg>;
     return dynamic::SelectFrom::Field{dynamic::Operation{
         .val = dynamic::Aggregation{DynamicAggregationType{
-            .val = Ref<dynamic::Operation>::make(
+            .val = sqlgen::internal::make_node<dynamic::Operation>(
                 MakeField<TableTupleType, std::remove_cvref_t<ValueType>>{}(
                     _val.val)
                     .val)}}}};
@@ -227,7 +228,7 @@ struct MakeField<TableTupleType, Operation<Operator::cast, Operand1Type,
   dynamic::SelectFrom::Field operator()(const auto& _o) const {
     return dynamic::SelectFrom::Field{
         dynamic::Operation{dynamic::Operation::Cast{
-            .op1 = Ref<dynamic::Operation>::make(
+            .op1 = sqlgen::internal::make_node<dynamic::Operation>(
                 MakeField<TableTupleType, std::remove_cvref_t<Operand1Type>>{}(
                     _o.operand1)
                     .val),
@@ -254,7 +255,7 @@ struct MakeField<TableTupleType,
   dynamic::SelectFrom::Field operator()(const auto& _o) const {
     return dynamic::SelectFrom::Field{
         dynamic::Operation{dynamic::Operation::DatePlusDuration{
-            .date = Ref<dynamic::Operation>::make(
+            .date = sqlgen::internal::make_node<dynamic::Operation>(
                 MakeField<TableTupleType, std::remove_cvref_t<Operand1Type>>{}(
                     _o.operand1)
                     .val),
@@ -280,7 +281,7 @@ struct MakeField<TableTupleType, Operation<_op, Operand1Type>> {
   dynamic::SelectFrom::Field operator()(const auto& _o) const {
     using DynamicOperatorType = dynamic_operator_t<_op>;
     return dynamic::SelectFrom::Field{dynamic::Operation{DynamicOperatorType{
-        .op1 = Ref<dynamic::Operation>::make(
+        .op1 = sqlgen::internal::make_node<dynamic::Operation>(
             MakeField<TableTupleType, std::remove_cvref_t<Operand1Type>>{}(
                 _o.operand1)
                 .val)}}};
@@ -303,11 +304,11 @@ struct MakeField<TableTupleType, Operation<_op, Operand1Type, Operand2Type>> {
   dynamic::SelectFrom::Field operator()(const auto& _o) const {
     using DynamicOperatorType = dynamic_operator_t<_op>;
     return dynamic::SelectFrom::Field{dynamic::Operation{DynamicOperatorType{
-        .op1 = Ref<dynamic::Operation>::make(
+        .op1 = sqlgen::internal::make_node<dynamic::Operation>(
             MakeField<TableTupleType, std::remove_cvref_t<Operand1Type>>{}(
                 _o.operand1)
                 .val),
-        .op2 = Ref<dynamic::Operation>::make(
+        .op2 = sqlgen::internal::make_node<dynamic::Operation>(
             MakeField<TableTupleType, std::remove_cvref_t<Operand2Type>>{}(
                 _o.operand2)
                 .val)}}};
@@ -332,15 +333,15 @@ struct MakeField<TableTupleType,
   dynamic::SelectFrom::Field operator()(const auto& _o) const {
     return dynamic::SelectFrom::Field{
         dynamic::Operation{dynamic::Operation::Replace{
-            .op1 = Ref<dynamic::Operation>::make(
+            .op1 = sqlgen::internal::make_node<dynamic::Operation>(
                 MakeField<TableTupleType, std::remove_cvref_t<Operand1Type>>{}(
                     _o.operand1)
                     .val),
-            .op2 = Ref<dynamic::Operation>::make(
+            .op2 = sqlgen::internal::make_node<dynamic::Operation>(
                 MakeField<TableTupleType, std::remove_cvref_t<Operand2Type>>{}(
                     _o.operand2)
                     .val),
-            .op3 = Ref<dynamic::Operation>::make(
+            .op3 = sqlgen::internal::make_node<dynamic::Operation>(
                 MakeField<TableTupleType, std::remove_cvref_t<Operand3Type>>{}(
                     _o.operand3)
                     .val)}}};
@@ -365,7 +366,7 @@ struct MakeField<TableTupleType, Operation<_op, rfl::Tuple<OperandTypes...>>> {
         .ops = rfl::apply(
             [](const auto&... _ops) {
               return std::vector<Ref<dynamic::Operation>>(
-                  {Ref<dynamic::Operation>::make(
+                  {sqlgen::internal::make_node<dynamic::Operation>(
                       MakeField<TableTupleType,
                                 std::remove_cvref_t<OperandTypes>>{}(_ops)
                           .val)...});
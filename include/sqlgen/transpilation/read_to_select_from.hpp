@@ -12,6 +12,7 @@
 #include "../dynamic/ColumnOrAggregation.hpp"
 #include "../dynamic/SelectFrom.hpp"
 #include "../dynamic/Table.hpp"
+#include "../internal/NodeArena.hpp"
 #include "../internal/collect/vector.hpp"
 #include "get_schema.hpp"
 #include "get_tablename.hpp"
@@ -30,6 +31,8 @@ dynamic::SelectFrom read_to_select_from(const WhereType& _where = WhereType{},
                                         const LimitType& _limit = LimitType{}) {
   using namespace std::ranges::views;
 
+  const sqlgen::internal::NodeArena::Scope arena_scope;
+
   using NamedTupleType = rfl::named_tuple_t<std::remove_cvref_t<T>>;
   using Fields = typename NamedTupleType::Fields;
 
@@ -10,6 +10,7 @@
 #include "../Ref.hpp"
 #include "../Result.hpp"
 #include "../dynamic/Condition.hpp"
+#include "../internal/NodeArena.hpp"
 #include "../internal/collect/vector.hpp"
 #include "Condition.hpp"
 #include "all_columns_exist.hpp"
@@ -37,9 +38,9 @@ struct ToCondition<T, conditions::And<CondType1, CondType2>> {
   dynamic::Condition operator()(const auto& _cond) const {
     return dynamic::Condition{
         .val = dynamic::Condition::And{
-            .cond1 = Ref<dynamic::Condition>::make(
+            .cond1 = sqlgen::internal::make_node<dynamic::Condition>(
                 ToCondition<T, std::remove_cvref_t<CondType1>>{}(_cond.cond1)),
-            .cond2 = Ref<dynamic::Condition>::make(
+            .cond2 = sqlgen::internal::make_node<dynamic::Condition>(
                 ToCondition<T, std::remove_cvref_t<CondType2>>{}(_cond.cond2)),
         }};
   }
@@ -207,7 +208,7 @@ struct ToCondition<T, conditions::Not<CondType>> {
   dynamic::Condition operator()(const auto& _cond) const {
     return dynamic::Condition{
         .val = dynamic::Condition::Not{
-            .cond = Ref<dynamic::Condition>::make(
+            .cond = sqlgen::internal::make_node<dynamic::Condition>(
                 ToCondition<T, std::remove_cvref_t<CondType>>{}(_cond.cond))}};
   }
 };
@@ -290,9 +291,9 @@ struct ToCondition<T, conditions::Or<CondType1, CondType2>> {
   dynamic::Condition operator()(const auto& _cond) const {
     return dynamic::Condition{
         .val = dynamic::Condition::Or{
-            .cond1 = Ref<dynamic::Condition>::make(
+            .cond1 = sqlgen::internal::make_node<dynamic::Condition>(
                 ToCondition<T, std::remove_cvref_t<CondType1>>{}(_cond.cond1)),
-            .cond2 = Ref<dynamic::Condition>::make(
+            .cond2 = sqlgen::internal::make_node<dynamic::Condition>(
                 ToCondition<T, std::remove_cvref_t<CondType2>>{}(_cond.cond2)),
         }};
   }
@@ -10,6 +10,7 @@
 
 #include "../dynamic/CreateIndex.hpp"
 #include "../dynamic/Table.hpp"
+#include "../internal/NodeArena.hpp"
 #include "get_schema.hpp"
 #include "get_tablename.hpp"
 #include "to_condition.hpp"
@@ -23,6 +24,8 @@ dynamic::CreateIndex to_create_index(const std::string& _name,
                                      const bool _unique,
                                      const bool _if_not_exists,
                                      const WhereType& _where) {
+  const sqlgen::internal::NodeArena::Scope arena_scope;
+
   return dynamic::CreateIndex{
       .name = _name,
       .table = dynamic::Table{.alias = std::nullopt,
@@ -9,6 +9,7 @@
 #include "../Result.hpp"
 #include "../dynamic/DeleteFrom.hpp"
 #include "../dynamic/Table.hpp"
+#include "../internal/NodeArena.hpp"
 #include "get_schema.hpp"
 #include "get_table_or_view.hpp"
 #include "get_tablename.hpp"
@@ -23,6 +24,8 @@ dynamic::DeleteFrom to_delete_from(const WhereType& _where) {
   static_assert(get_table_or_view<T>() == dynamic::TableOrView::table,
                 "You cannot call delete_from on a view.");
 
+  const sqlgen::internal::NodeArena::Scope arena_scope;
+
   return dynamic::DeleteFrom{
       .table = dynamic::Table{.alias = std::nullopt,
                               .name = get_tablename<T>(),
@@ -13,6 +13,7 @@
 #include "../dynamic/Join.hpp"
 #include "../dynamic/SelectFrom.hpp"
 #include "../dynamic/Table.hpp"
+#include "../internal/NodeArena.hpp"
 #include "../internal/collect/vector.hpp"
 #include "Join.hpp"
 #include "TableWrapper.hpp"
@@ -44,6 +45,8 @@ dynamic::SelectFrom to_select_from(const FieldsType& _fields,
                 "The aggregations were not set up correctly. Please check the "
                 "trace for a more detailed error message.");
 
+  const sqlgen::internal::NodeArena::Scope arena_scope;
+
   const auto fields = make_fields<TableTupleType, FieldsType>(
       _fields,
       std::make_integer_sequence<int, rfl::tuple_size_v<FieldsType>>());
@@ -9,6 +9,7 @@
 #include "../Result.hpp"
 #include "../dynamic/Table.hpp"
 #include "../dynamic/Update.hpp"
+#include "../internal/NodeArena.hpp"
 #include "get_schema.hpp"
 #include "get_tablename.hpp"
 #include "to_condition.hpp"
@@ -20,6 +21,8 @@ template <class T, class SetsType, class WhereType>
   requires std::is_class_v<std::remove_cvref_t<T>> &&
            std::is_aggregate_v<std::remove_cvref_t<T>>
 dynamic::Update to_update(const SetsType& _sets, const WhereType& _where) {
+  const sqlgen::internal::NodeArena::Scope arena_scope;
+
   return dynamic::Update{.table = dynamic::Table{.alias = std::nullopt,
                                                  .name = get_tablename<T>(),
                                                  .schema = get_schema<T>()},
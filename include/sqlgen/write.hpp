@@ -12,10 +12,14 @@
 
 #include "Ref.hpp"
 #include "Result.hpp"
+#include "batch_size.hpp"
 #include "dynamic/Write.hpp"
-#include "internal/batch_size.hpp"
+#include "internal/WriteOptions.hpp"
+#include "internal/invalidate_cached.hpp"
+#include "internal/static_sql.hpp"
 #include "internal/to_str_vec.hpp"
 #include "is_connection.hpp"
+#include "transpilation/get_tablename.hpp"
 #include "transpilation/to_create_table.hpp"
 #include "transpilation/to_insert_or_write.hpp"
 
@@ -23,19 +27,20 @@ namespace sqlgen {
 
 template <class ItBegin, class ItEnd, class Connection>
   requires is_connection<Connection>
-Result<Ref<Connection>> write(const Ref<Connection>& _conn, ItBegin _begin,
-                              ItEnd _end) noexcept {
+Result<Ref<Connection>> write_impl(
+    const Ref<Connection>& _conn, ItBegin _begin, ItEnd _end,
+    const internal::WriteOptions& _options) noexcept {
   using T =
       std::remove_cvref_t<typename std::iterator_traits<ItBegin>::value_type>;
 
+  using DialectType = internal::dialect_t<Connection>;
+
   const auto start_write = [&](const auto&) -> Result<Nothing> {
-    const auto write_stmt =
-        transpilation::to_insert_or_write<T, dynamic::Write>();
-    return _conn->start_write(write_stmt);
+    return _conn->start_write(internal::write_sql<T, DialectType>());
   };
 
   const auto write = [&](const auto&) -> Result<Nothing> {
-    const auto res = _conn->write(_begin, _end);
+    const auto res = _conn->write(_begin, _end, _options);
     if (!res) {
       _conn->end_write();
     }
@@ -46,43 +51,88 @@ Result<Ref<Connection>> write(const Ref<Connection>& _conn, ItBegin _begin,
     return _conn->end_write();
   };
 
-  const auto create_table_stmt = transpilation::to_create_table<T>();
+  const auto res =
+      _conn->execute(internal::create_table_sql<T, DialectType, true>())
+          .and_then(start_write)
+          .and_then(write)
+          .and_then(end_write);
+  internal::invalidate_cached(_conn, transpilation::get_tablename<T>());
+  return res.transform([&](const auto&) { return _conn; });
+}
+
+template <class ItBegin, class ItEnd, class Connection>
+  requires is_connection<Connection>
+Result<Ref<Connection>> write_impl(
+    const Result<Ref<Connection>>& _res, ItBegin _begin, ItEnd _end,
+    const internal::WriteOptions& _options) noexcept {
+  return _res.and_then([&](const auto& _conn) {
+    return write_impl(_conn, _begin, _end, _options);
+  });
+}
+
+template <class ContainerType>
+auto write_impl(const auto& _conn, const ContainerType& _container,
+                const internal::WriteOptions& _options) noexcept {
+  if constexpr (std::ranges::input_range<std::remove_cvref_t<ContainerType>>) {
+    return write_impl(_conn, _container.begin(), _container.end(), _options);
+  } else {
+    return write_impl(_conn, &_container, &_container + 1, _options);
+  }
+}
+
+template <class ContainerType>
+auto write_impl(const auto& _conn,
+                const std::reference_wrapper<ContainerType>& _data,
+                const internal::WriteOptions& _options) {
+  return write_impl(_conn, _data.get(), _options);
+}
 
-  return _conn->execute(_conn->to_sql(create_table_stmt))
-      .and_then(start_write)
-      .and_then(write)
-      .and_then(end_write)
-      .transform([&](const auto&) { return _conn; });
+template <class ItBegin, class ItEnd, class Connection>
+  requires is_connection<Connection>
+Result<Ref<Connection>> write(const Ref<Connection>& _conn, ItBegin _begin,
+                              ItEnd _end) noexcept {
+  return write_impl(_conn, _begin, _end, internal::WriteOptions{});
 }
 
 template <class ItBegin, class ItEnd, class Connection>
   requires is_connection<Connection>
 Result<Ref<Connection>> write(const Result<Ref<Connection>>& _res,
                               ItBegin _begin, ItEnd _end) noexcept {
-  return _res.and_then(
-      [&](const auto& _conn) { return write(_conn, _begin, _end); });
+  return write_impl(_res, _begin, _end, internal::WriteOptions{});
 }
 
 template <class ContainerType>
 auto write(const auto& _conn, const ContainerType& _container) noexcept {
-  if constexpr (std::ranges::input_range<std::remove_cvref_t<ContainerType>>) {
-    return write(_conn, _container.begin(), _container.end());
-  } else {
-    return write(_conn, &_container, &_container + 1);
-  }
+  return write_impl(_conn, _container, internal::WriteOptions{});
 }
 
 template <class ContainerType>
 auto write(const auto& _conn,
            const std::reference_wrapper<ContainerType>& _data) {
-  return write(_conn, _data.get());
+  return write_impl(_conn, _data, internal::WriteOptions{});
 }
 
 template <class ContainerType>
 struct Write {
-  auto operator()(const auto& _conn) const { return write(_conn, data_); }
+  auto operator()(const auto& _conn) const {
+    return write_impl(_conn, data_, options_);
+  }
+
+  friend auto operator|(const Write& _w, const BatchSize& _b) {
+    auto w = _w;
+    w.options_.batch_size = _b.val;
+    return w;
+  }
+
+  friend auto operator|(const Write& _w, const BatchBytes& _b) {
+    auto w = _w;
+    w.options_.batch_bytes = _b.val;
+    return w;
+  }
 
   ContainerType data_;
+
+  internal::WriteOptions options_;
 };
 
 template <class ContainerType>
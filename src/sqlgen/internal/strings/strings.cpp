@@ -60,6 +60,18 @@ std::string replace_all(const std::string& _str, const std::string& _from,
   return str;
 }
 
+void append_replace_all(const std::string_view _str, const char _from,
+                        const std::string_view _to, std::string* _out) {
+  size_t begin = 0;
+  size_t pos = 0;
+  while ((pos = _str.find(_from, begin)) != std::string_view::npos) {
+    _out->append(_str.substr(begin, pos - begin));
+    _out->append(_to);
+    begin = pos + 1;
+  }
+  _out->append(_str.substr(begin));
+}
+
 std::vector<std::string> split(const std::string& _str,
                                const std::string& _delimiter) {
   auto str = _str;
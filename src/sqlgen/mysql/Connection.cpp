@@ -19,9 +19,8 @@ Connection::Connection(const Credentials& _credentials)
 
 Connection::~Connection() = default;
 
-Result<Nothing> Connection::actual_insert(
-    const std::vector<std::vector<std::optional<std::string>>>& _data,
-    MYSQL_STMT* _stmt) const noexcept {
+Result<Nothing> Connection::actual_insert(const internal::RowBatch& _data,
+                                          MYSQL_STMT* _stmt) const noexcept {
   const auto num_params = static_cast<size_t>(mysql_stmt_param_count(_stmt));
 
   std::vector<MYSQL_BIND> bind(num_params);
@@ -29,23 +28,24 @@ Result<Nothing> Connection::actual_insert(
   std::vector<long unsigned int> lengths(num_params);
   std::vector<my_bool> is_null(num_params);
 
-  for (const auto& row : _data) {
-    memset(bind.data(), 0, sizeof(MYSQL_BIND) * num_params);
+  if (!_data.empty() && _data.num_cols() != num_params) {
+    return error("Expected " + std::to_string(num_params) + " fields, got " +
+                 std::to_string(_data.num_cols()) + ".");
+  }
 
-    if (row.size() != num_params) {
-      return error("Expected " + std::to_string(num_params) + " fields, got " +
-                   std::to_string(row.size()) + ".");
-    }
+  for (size_t r = 0; r < _data.size(); ++r) {
+    memset(bind.data(), 0, sizeof(MYSQL_BIND) * num_params);
 
-    auto buffer = row;
+    const auto row = _data[r];
 
     for (size_t i = 0; i < num_params; ++i) {
-      if (buffer[i]) {
-        lengths[i] = static_cast<long unsigned int>(row[i]->size());
+      if (const auto ptr = row.c_str(i)) {
+        lengths[i] = static_cast<long unsigned int>(row.length(i));
         is_null[i] = 0;
 
         bind[i].buffer_type = MYSQL_TYPE_STRING;
-        bind[i].buffer = &((*buffer[i])[0]);
+        // MySQL only reads from input buffers, it never writes to them.
+        bind[i].buffer = const_cast<char*>(ptr);
         bind[i].buffer_length = lengths[i];
         bind[i].is_null = &(is_null[i]);
         bind[i].length = &(lengths[i]);
@@ -86,13 +86,11 @@ Result<Nothing> Connection::execute(const std::string& _sql) noexcept {
 }
 
 Result<Nothing> Connection::insert_impl(
-    const dynamic::Insert& _stmt,
-    const std::vector<std::vector<std::optional<std::string>>>&
-        _data) noexcept {
+    const std::string& _sql, const internal::RowBatch& _data) noexcept {
   if (_data.size() == 0) {
     return Nothing{};
   }
-  return prepare_statement(_stmt).and_then(
+  return prepare_statement(_sql).and_then(
       [&](auto&& _stmt_ptr) { return actual_insert(_data, _stmt_ptr.get()); });
 }
 
@@ -126,21 +124,19 @@ typename Connection::ConnPtr Connection::make_conn(
 }
 
 Result<Connection::StmtPtr> Connection::prepare_statement(
-    const std::variant<dynamic::Insert, dynamic::Write>& _stmt) const noexcept {
-  const auto sql = std::visit(to_sql_impl, _stmt);
+    const std::string& _sql) const noexcept {
   const auto stmt_ptr = StmtPtr(mysql_stmt_init(conn_.get()), mysql_stmt_close);
-  const auto err = mysql_stmt_prepare(stmt_ptr.get(), sql.c_str(),
-                                      static_cast<unsigned long>(sql.size()));
+  const auto err = mysql_stmt_prepare(stmt_ptr.get(), _sql.c_str(),
+                                      static_cast<unsigned long>(_sql.size()));
   if (err) {
     return make_error(conn_);
   }
   return stmt_ptr;
 }
 
-Result<Ref<Iterator>> Connection::read_impl(const dynamic::SelectFrom& _query) {
-  const auto sql = mysql::to_sql_impl(_query);
-  const auto err =
-      mysql_real_query(conn_.get(), sql.c_str(), static_cast<int>(sql.size()));
+Result<Ref<Iterator>> Connection::read_impl(const std::string& _sql) {
+  const auto err = mysql_real_query(conn_.get(), _sql.c_str(),
+                                    static_cast<int>(_sql.size()));
   if (err) {
     return make_error(conn_);
   }
@@ -156,13 +152,17 @@ Result<Ref<Iterator>> Connection::read_impl(const dynamic::SelectFrom& _query) {
 Result<Nothing> Connection::rollback() noexcept { return execute("ROLLBACK;"); }
 
 Result<Nothing> Connection::start_write(const dynamic::Write& _write_stmt) {
+  return start_write(to_sql_impl(_write_stmt));
+}
+
+Result<Nothing> Connection::start_write(const std::string& _sql) {
   if (stmt_) {
     return error(
         "A write operation has already been launched. You need to call "
         ".end_write() before you can start another.");
   }
   return begin_transaction()
-      .and_then([&](auto&&) { return prepare_statement(_write_stmt); })
+      .and_then([&](auto&&) { return prepare_statement(_sql); })
       .transform([&](auto&& _stmt) {
         stmt_ = _stmt;
         return Nothing{};
@@ -177,8 +177,7 @@ std::string Connection::to_sql(const dynamic::Statement& _stmt) noexcept {
   return to_sql_impl(_stmt);
 }
 
-Result<Nothing> Connection::write_impl(
-    const std::vector<std::vector<std::optional<std::string>>>& _data) {
+Result<Nothing> Connection::write_impl(const internal::RowBatch& _data) {
   if (!stmt_) {
     return error(
         " You need to call .start_write(...) before you can call "
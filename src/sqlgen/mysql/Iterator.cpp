@@ -1,5 +1,7 @@
 #include "sqlgen/mysql/Iterator.hpp"
 
+#include <string_view>
+
 namespace sqlgen::mysql {
 
 Iterator::Iterator(const ResPtr& _res, const ConnPtr& _conn)
@@ -9,9 +11,9 @@ Iterator::~Iterator() = default;
 
 bool Iterator::end() const { return end_; }
 
-Result<std::vector<std::vector<std::optional<std::string>>>> Iterator::next(
-    const size_t _batch_size) {
-  std::vector<std::vector<std::optional<std::string>>> vec;
+Result<internal::RowBatch> Iterator::next(const size_t _batch_size,
+                                          const size_t _batch_bytes) {
+  internal::RowBatch batch;
 
   const unsigned int num_fields = mysql_num_fields(res_.get());
 
@@ -24,23 +26,27 @@ Result<std::vector<std::vector<std::optional<std::string>>>> Iterator::next(
         return error(err);
       }
       end_ = true;
-      return vec;
+      return batch;
     }
 
-    std::vector<std::optional<std::string>> res_row(num_fields);
+    const auto lengths = mysql_fetch_lengths(res_.get());
 
     for (unsigned int j = 0; j < num_fields; ++j) {
       if (row[j]) {
-        res_row[j] = std::string(row[j]);
+        batch.append(std::string_view(row[j], lengths[j]));
       } else {
-        res_row[j] = std::nullopt;
+        batch.append_null();
       }
     }
 
-    vec.emplace_back(std::move(res_row));
+    batch.end_row();
+
+    if (_batch_bytes != 0 && batch.num_bytes() >= _batch_bytes) {
+      return batch;
+    }
   }
 
-  return vec;
+  return batch;
 }
 
 }  // namespace sqlgen::mysql
@@ -5,15 +5,15 @@
 #include <sstream>
 #include <stdexcept>
 
-#include "sqlgen/internal/collect/vector.hpp"
 #include "sqlgen/internal/random.hpp"
-#include "sqlgen/internal/strings/strings.hpp"
 #include "sqlgen/postgres/Iterator.hpp"
 
 namespace sqlgen::postgres {
 
 Connection::Connection(const Credentials& _credentials)
-    : conn_(make_conn(_credentials.to_str())), credentials_(_credentials) {}
+    : conn_(make_conn(_credentials.to_str())),
+      credentials_(_credentials),
+      cursors_(Ref<Iterator::Cursors>::make()) {}
 
 Connection::~Connection() = default;
 
@@ -42,44 +42,32 @@ Result<Nothing> Connection::end_write() {
 }
 
 Result<Nothing> Connection::insert_impl(
-    const dynamic::Insert& _stmt,
-    const std::vector<std::vector<std::optional<std::string>>>&
-        _data) noexcept {
+    const std::string& _sql, const internal::RowBatch& _data) noexcept {
   if (_data.size() == 0) {
     return Nothing{};
   }
 
   const auto name = "sqlgen_insert_into_table_" + internal::random();
 
-  const auto sql = to_sql_impl(_stmt);
-
-  const auto res = PQprepare(conn_.get(), name.c_str(), sql.c_str(),
-                             _data.at(0).size(), nullptr);
+  const auto res = PQprepare(conn_.get(), name.c_str(), _sql.c_str(),
+                             static_cast<int>(_data.num_cols()), nullptr);
 
   const auto status = PQresultStatus(res);
 
   if (status != PGRES_COMMAND_OK) {
-    return error("Generating prepared statement for '" + sql +
+    return error("Generating prepared statement for '" + _sql +
                  "' failed: " + PQresultErrorMessage(res));
   }
 
-  std::vector<const char*> current_row(_data[0].size());
+  std::vector<const char*> current_row(_data.num_cols());
 
   const int n_params = static_cast<int>(current_row.size());
 
   for (size_t i = 0; i < _data.size(); ++i) {
-    const auto& d = _data[i];
-
-    if (d.size() != current_row.size()) {
-      execute("ROLLBACK;");
-      execute("DEALLOCATE " + name + ";");
-      return error("Error in entry " + std::to_string(i) + ": Expected " +
-                   std::to_string(current_row.size()) + " entries, got " +
-                   std::to_string(d.size()));
-    }
+    const auto d = _data[i];
 
     for (size_t j = 0; j < d.size(); ++j) {
-      current_row[j] = d[j] ? d[j]->c_str() : nullptr;
+      current_row[j] = d.c_str(j);
     }
 
     const auto res = PQexecPrepared(conn_.get(),         // conn
@@ -129,35 +117,59 @@ typename Connection::ConnPtr Connection::make_conn(
   return ConnPtr::make(std::shared_ptr<PGconn>(raw_ptr, &PQfinish)).value();
 }
 
-Result<Ref<Iterator>> Connection::read_impl(const dynamic::SelectFrom& _query) {
-  const auto sql = postgres::to_sql_impl(_query);
+Result<Ref<Iterator>> Connection::read_impl(
+    const std::string& _sql, const internal::ReadOptions& _options) {
+  // For small results, a cursor would cost more round trips than the query
+  // itself.
+  if (_options.small_result) {
+    return exec(conn_, _sql).transform([&](const auto& _res) {
+      return Ref<Iterator>::make(_res, conn_, cursors_);
+    });
+  }
   try {
-    return Ref<Iterator>::make(sql, conn_);
+    return Ref<Iterator>::make(_sql, conn_, cursors_);
   } catch (std::exception& e) {
     return error(e.what());
   }
 }
 
-Result<Nothing> Connection::rollback() noexcept { return execute("ROLLBACK;"); }
+Result<Nothing> Connection::notify_invalidation(
+    const std::string& _table) noexcept {
+  if (!credentials_.notify_invalidation) {
+    return Nothing{};
+  }
+  std::string payload;
+  for (const char c : _table) {
+    if (c == '\'') {
+      payload += '\'';
+    }
+    payload += c;
+  }
+  return execute("NOTIFY " + std::string(INVALIDATION_CHANNEL) + ", '" +
+                 payload + "';");
+}
 
-std::string Connection::to_buffer(
-    const std::vector<std::optional<std::string>>& _line) const noexcept {
-  using namespace std::ranges::views;
+Result<Nothing> Connection::rollback() noexcept { return execute("ROLLBACK;"); }
 
-  const auto edit_field =
-      [](const std::optional<std::string>& _field) -> std::string {
-    if (!_field) {
-      return "\e";
+void Connection::to_buffer(const internal::RowBatch::Row& _line,
+                           std::string* _buffer) const noexcept {
+  _buffer->clear();
+  for (size_t j = 0; j < _line.size(); ++j) {
+    if (j != 0) {
+      _buffer->push_back('\t');
     }
-    if (_field->find("\t") != std::string::npos) {
-      return "\a" + *_field + "\a";
+    const auto field = _line[j];
+    if (!field) {
+      _buffer->push_back('\e');
+    } else if (field->find('\t') != std::string_view::npos) {
+      _buffer->push_back('\a');
+      _buffer->append(*field);
+      _buffer->push_back('\a');
+    } else {
+      _buffer->append(*field);
     }
-    return *_field;
-  };
-
-  return internal::strings::join(
-             "\t", internal::collect::vector(_line | transform(edit_field))) +
-         "\n";
+  }
+  _buffer->push_back('\n');
 }
 
 std::string Connection::to_sql(const dynamic::Statement& _stmt) noexcept {
@@ -165,13 +177,17 @@ std::string Connection::to_sql(const dynamic::Statement& _stmt) noexcept {
 }
 
 Result<Nothing> Connection::start_write(const dynamic::Write& _stmt) {
-  return execute(postgres::to_sql_impl(_stmt));
+  return start_write(postgres::to_sql_impl(_stmt));
+}
+
+Result<Nothing> Connection::start_write(const std::string& _sql) {
+  return execute(_sql);
 }
 
-Result<Nothing> Connection::write_impl(
-    const std::vector<std::vector<std::optional<std::string>>>& _data) {
-  for (const auto& line : _data) {
-    const auto buffer = to_buffer(line);
+Result<Nothing> Connection::write_impl(const internal::RowBatch& _data) {
+  std::string buffer;
+  for (size_t i = 0; i < _data.size(); ++i) {
+    to_buffer(_data[i], &buffer);
     const auto success = PQputCopyData(conn_.get(), buffer.c_str(),
                                        static_cast<int>(buffer.size()));
     if (success != 1) {
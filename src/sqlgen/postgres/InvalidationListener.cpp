@@ -0,0 +1,112 @@
+#include "sqlgen/postgres/InvalidationListener.hpp"
+
+#ifdef _WIN32
+#include <winsock2.h>
+#else
+#include <sys/select.h>
+#endif
+
+#include <stdexcept>
+
+#include "sqlgen/internal/TableVersions.hpp"
+#include "sqlgen/postgres/Connection.hpp"
+#include "sqlgen/postgres/exec.hpp"
+
+namespace sqlgen::postgres {
+
+InvalidationListener::InvalidationListener(const Credentials& _credentials)
+    : conn_(make_conn(_credentials.to_str())),
+      stopped_(false),
+      thread_([this]() { listen(); }) {}
+
+InvalidationListener::~InvalidationListener() {
+  stopped_ = true;
+  thread_.join();
+}
+
+Result<Ref<InvalidationListener>> InvalidationListener::make(
+    const Credentials& _credentials) noexcept {
+  try {
+    return Ref<InvalidationListener>::make(_credentials);
+  } catch (std::exception& e) {
+    return error(e.what());
+  }
+}
+
+void InvalidationListener::listen() {
+  while (!stopped_) {
+    if (PQstatus(conn_.get()) != CONNECTION_OK) {
+      reconnect();
+      continue;
+    }
+    wait_for_input();
+    process_notifications();
+  }
+}
+
+typename InvalidationListener::ConnPtr InvalidationListener::make_conn(
+    const std::string& _conn_str) {
+  const auto raw_ptr = PQconnectdb(_conn_str.c_str());
+
+  if (PQstatus(raw_ptr) != CONNECTION_OK) {
+    const auto msg = std::string("Connection to postgres failed: ") +
+                     PQerrorMessage(raw_ptr);
+    PQfinish(raw_ptr);
+    throw std::runtime_error(msg.c_str());
+  }
+
+  const auto conn =
+      ConnPtr::make(std::shared_ptr<PGconn>(raw_ptr, &PQfinish)).value();
+
+  exec(conn, "LISTEN " + std::string(INVALIDATION_CHANNEL) + ";").value();
+
+  return conn;
+}
+
+void InvalidationListener::process_notifications() {
+  // If this fails, the connection has been lost, which the next iteration
+  // of listen() takes care of.
+  if (PQconsumeInput(conn_.get()) == 0) {
+    return;
+  }
+  auto& versions = internal::TableVersions::instance();
+  PGnotify* notify = nullptr;
+  while ((notify = PQnotifies(conn_.get())) != nullptr) {
+    versions.bump(notify->extra);
+    PQfreemem(notify);
+  }
+}
+
+void InvalidationListener::reconnect() {
+  // Sleeps in steps of POLL_INTERVAL, so that stopping is not held up.
+  const auto until = std::chrono::steady_clock::now() + RECONNECT_INTERVAL;
+  while (!stopped_ && std::chrono::steady_clock::now() < until) {
+    std::this_thread::sleep_for(POLL_INTERVAL);
+  }
+  if (stopped_) {
+    return;
+  }
+  PQreset(conn_.get());
+  if (PQstatus(conn_.get()) != CONNECTION_OK ||
+      !exec(conn_, "LISTEN " + std::string(INVALIDATION_CHANNEL) + ";")) {
+    return;
+  }
+  internal::TableVersions::instance().bump_all();
+}
+
+void InvalidationListener::wait_for_input() {
+  const auto sock = PQsocket(conn_.get());
+  if (sock < 0) {
+    std::this_thread::sleep_for(POLL_INTERVAL);
+    return;
+  }
+  fd_set input;
+  FD_ZERO(&input);
+  FD_SET(sock, &input);
+  timeval timeout{};
+  timeout.tv_usec = static_cast<decltype(timeout.tv_usec)>(
+      std::chrono::microseconds(POLL_INTERVAL).count());
+  select(sock + 1, &input, nullptr, nullptr, &timeout);
+}
+
+}  // namespace sqlgen::postgres
@@ -1,25 +1,61 @@
 #include "sqlgen/postgres/Iterator.hpp"
 
+#include <algorithm>
 #include <ranges>
 #include <rfl.hpp>
 #include <sstream>
+#include <string_view>
 
-#include "sqlgen/internal/collect/vector.hpp"
-#include "sqlgen/internal/strings/strings.hpp"
 #include "sqlgen/postgres/exec.hpp"
 
 namespace sqlgen::postgres {
 
-Iterator::Iterator(const std::string& _sql, const ConnPtr& _conn)
-    : cursor_name_(make_cursor_name()), conn_(_conn), end_(false) {
-  exec(conn_, "BEGIN").value();
-  exec(conn_, "DECLARE " + cursor_name_ + " CURSOR FOR " + _sql).value();
+Iterator::Iterator(const std::string& _sql, const ConnPtr& _conn,
+                   const Ref<Cursors>& _cursors)
+    : cursor_name_(make_cursor_name()),
+      row_(0),
+      conn_(_conn),
+      cursors_(_cursors),
+      end_(false),
+      bytes_per_row_(0) {
+  // If we are already inside a transaction, either the caller's or the one
+  // begun for another cursor, the cursor simply joins it.
+  const bool begin_transaction =
+      PQtransactionStatus(conn_.get()) == PQTRANS_IDLE;
+  if (begin_transaction) {
+    exec(conn_, "BEGIN").value();
+  }
+  const auto res =
+      exec(conn_, "DECLARE " + cursor_name_ + " CURSOR FOR " + _sql);
+  if (!res) {
+    if (begin_transaction) {
+      exec(conn_, "ROLLBACK");
+    }
+    res.value();
+  }
+  if (begin_transaction) {
+    cursors_->owns_transaction = true;
+  }
+  ++cursors_->num_open;
 }
 
+Iterator::Iterator(const Ref<PGresult>& _res, const ConnPtr& _conn,
+                   const Ref<Cursors>& _cursors)
+    : res_(_res),
+      row_(0),
+      conn_(_conn),
+      cursors_(_cursors),
+      end_(PQntuples(_res.get()) == 0),
+      bytes_per_row_(0) {}
+
 Iterator::Iterator(Iterator&& _other) noexcept
     : cursor_name_(std::move(_other.cursor_name_)),
+      res_(std::move(_other.res_)),
+      row_(_other.row_),
       conn_(std::move(_other.conn_)),
-      end_(_other.end_) {
+      cursors_(_other.cursors_),
+      end_(_other.end_),
+      bytes_per_row_(_other.bytes_per_row_) {
   _other.end_ = true;
 }
 
@@ -27,45 +63,55 @@ Iterator::~Iterator() { shutdown(); }
 
 bool Iterator::end() const { return end_; }
 
-Result<std::vector<std::vector<std::optional<std::string>>>> Iterator::next(
-    const size_t _batch_size) {
+Result<internal::RowBatch> Iterator::next(const size_t _batch_size,
+                                          const size_t _batch_bytes) {
   if (end()) {
     return error("End is reached.");
   }
 
-  const auto to_vector = [](const Ref<PGresult>& _res)
-      -> std::vector<std::vector<std::optional<std::string>>> {
-    const int num_rows = PQntuples(_res.get());
-    const int num_cols = PQnfields(_res.get());
-
-    std::vector<std::vector<std::optional<std::string>>> vec(num_rows);
-
-    for (int i = 0; i < num_rows; ++i) {
-      std::vector<std::optional<std::string>> row(num_cols);
-
+  // The complete result is already here, we just need to cut it into
+  // batches.
+  if (res_) {
+    const int num_rows = PQntuples(res_->get());
+    const int num_cols = PQnfields(res_->get());
+    int end = row_;
+    size_t num_bytes = 0;
+    while (end < num_rows && static_cast<size_t>(end - row_) < _batch_size &&
+           (_batch_bytes == 0 || num_bytes < _batch_bytes)) {
       for (int j = 0; j < num_cols; ++j) {
-        const bool is_null = PQgetisnull(_res.get(), i, j);
-        if (is_null) {
-          row[j] = std::nullopt;
-        } else {
-          row[j] = std::string(PQgetvalue(_res.get(), i, j));
-        }
+        num_bytes += static_cast<size_t>(PQgetlength(res_->get(), end, j));
       }
-
-      vec[i] = std::move(row);
+      ++end;
     }
+    auto batch = to_batch(*res_, row_, end);
+    row_ = end;
+    end_ = row_ == num_rows;
+    return batch;
+  }
 
-    return vec;
-  };
+  // FETCH cannot cut off a batch by its size, so we estimate how many rows
+  // fit into _batch_bytes based on the rows we have seen so far.
+  auto num_rows = _batch_size;
+  if (_batch_bytes != 0) {
+    num_rows = bytes_per_row_ == 0
+                   ? std::min(_batch_size, NUM_ROWS_TO_ESTIMATE)
+                   : std::clamp(_batch_bytes / bytes_per_row_, size_t(1),
+                                _batch_size);
+  }
 
-  return exec(conn_, "FETCH FORWARD " + std::to_string(_batch_size) + " FROM " +
+  return exec(conn_, "FETCH FORWARD " + std::to_string(num_rows) + " FROM " +
                          cursor_name_ + ";")
-      .transform(to_vector)
-      .transform([this](auto&& _vec) {
-        if (_vec.size() == 0) {
+      .transform([](const Ref<PGresult>& _res) {
+        return to_batch(_res, 0, PQntuples(_res.get()));
+      })
+      .transform([this](auto&& _batch) {
+        if (_batch.size() == 0) {
           shutdown();
+        } else {
+          bytes_per_row_ =
+              std::max(_batch.num_bytes() / _batch.size(), size_t(1));
         }
-        return std::move(_vec);
+        return std::move(_batch);
       });
 }
 
@@ -75,16 +121,58 @@ Iterator& Iterator::operator=(Iterator&& _other) noexcept {
   }
   shutdown();
   cursor_name_ = std::move(_other.cursor_name_);
+  res_ = std::move(_other.res_);
+  row_ = _other.row_;
   conn_ = std::move(_other.conn_);
+  cursors_ = _other.cursors_;
   end_ = _other.end_;
+  bytes_per_row_ = _other.bytes_per_row_;
   _other.end_ = true;
   return *this;
 }
 
+internal::RowBatch Iterator::to_batch(const Ref<PGresult>& _res,
+                                     const int _begin, const int _end) {
+  const int num_cols = PQnfields(_res.get());
+
+  size_t num_bytes = 0;
+  for (int i = _begin; i < _end; ++i) {
+    for (int j = 0; j < num_cols; ++j) {
+      num_bytes += static_cast<size_t>(PQgetlength(_res.get(), i, j));
+    }
+  }
+
+  internal::RowBatch batch;
+  batch.reserve(
+      static_cast<size_t>(_end - _begin) * static_cast<size_t>(num_cols),
+      num_bytes);
+
+  for (int i = _begin; i < _end; ++i) {
+    for (int j = 0; j < num_cols; ++j) {
+      if (PQgetisnull(_res.get(), i, j)) {
+        batch.append_null();
+      } else {
+        batch.append(std::string_view(
+            PQgetvalue(_res.get(), i, j),
+            static_cast<size_t>(PQgetlength(_res.get(), i, j))));
+      }
+    }
+    batch.end_row();
+  }
+
+  return batch;
+}
+
 void Iterator::shutdown() {
   if (!end_) {
-    exec(conn_, "CLOSE " + cursor_name_);
-    exec(conn_, "END");
+    if (!res_) {
+      exec(conn_, "CLOSE " + cursor_name_);
+      --cursors_->num_open;
+      if (cursors_->num_open == 0 && cursors_->owns_transaction) {
+        exec(conn_, "END");
+        cursors_->owns_transaction = false;
+      }
+    }
     end_ = true;
   }
 }
@@ -2,7 +2,6 @@
 
 #include <ranges>
 #include <rfl.hpp>
-#include <sstream>
 #include <stdexcept>
 #include <type_traits>
 
@@ -13,31 +12,40 @@
 
 namespace sqlgen::postgres {
 
-std::string aggregation_to_sql(
-    const dynamic::Aggregation& _aggregation) noexcept;
+void aggregation_to_sql(const dynamic::Aggregation& _aggregation,
+                        std::string* _out) noexcept;
 
-std::string column_or_value_to_sql(const dynamic::ColumnOrValue& _col) noexcept;
+void column_or_value_to_sql(const dynamic::ColumnOrValue& _col,
+                            std::string* _out) noexcept;
 
-std::string condition_to_sql(const dynamic::Condition& _cond) noexcept;
+void condition_to_sql(const dynamic::Condition& _cond,
+                      std::string* _out) noexcept;
 
 template <class ConditionType>
-std::string condition_to_sql_impl(const ConditionType& _condition) noexcept;
+void condition_to_sql_impl(const ConditionType& _condition,
+                           std::string* _out) noexcept;
 
-std::string column_to_sql_definition(const dynamic::Column& _col) noexcept;
+void column_to_sql_definition(const dynamic::Column& _col,
+                              std::string* _out) noexcept;
 
-std::string create_index_to_sql(const dynamic::CreateIndex& _stmt) noexcept;
+void create_index_to_sql(const dynamic::CreateIndex& _stmt,
+                         std::string* _out) noexcept;
 
-std::string create_table_to_sql(const dynamic::CreateTable& _stmt) noexcept;
+void create_table_to_sql(const dynamic::CreateTable& _stmt,
+                         std::string* _out) noexcept;
 
-std::string create_as_to_sql(const dynamic::CreateAs& _stmt) noexcept;
+void create_as_to_sql(const dynamic::CreateAs& _stmt,
+                      std::string* _out) noexcept;
 
-std::string delete_from_to_sql(const dynamic::DeleteFrom& _stmt) noexcept;
+void delete_from_to_sql(const dynamic::DeleteFrom& _stmt,
+                        std::string* _out) noexcept;
 
-std::string drop_to_sql(const dynamic::Drop& _stmt) noexcept;
+void drop_to_sql(const dynamic::Drop& _stmt, std::string* _out) noexcept;
 
-std::string escape_single_quote(const std::string& _str) noexcept;
+void escape_single_quote(const std::string& _str, std::string* _out) noexcept;
 
-std::string field_to_str(const dynamic::SelectFrom::Field& _field) noexcept;
+void field_to_str(const dynamic::SelectFrom::Field& _field,
+                  std::string* _out) noexcept;
 
 std::vector<std::string> get_primary_keys(
     const dynamic::CreateTable& _stmt) noexcept;
@@ -45,25 +53,28 @@ std::vector<std::string> get_primary_keys(
 std::vector<std::pair<std::string, std::vector<std::string>>> get_enum_types(
     const dynamic::CreateTable& _stmt) noexcept;
 
-std::string insert_to_sql(const dynamic::Insert& _stmt) noexcept;
+void insert_to_sql(const dynamic::Insert& _stmt, std::string* _out) noexcept;
 
-std::string join_to_sql(const dynamic::Join& _stmt) noexcept;
+void join_to_sql(const dynamic::Join& _stmt, std::string* _out) noexcept;
 
-std::string operation_to_sql(const dynamic::Operation& _stmt) noexcept;
+void operation_to_sql(const dynamic::Operation& _stmt,
+                      std::string* _out) noexcept;
 
-std::string properties_to_sql(
-    const dynamic::types::Properties& _properties) noexcept;
+void properties_to_sql(const dynamic::types::Properties& _properties,
+                       std::string* _out) noexcept;
 
-std::string select_from_to_sql(const dynamic::SelectFrom& _stmt) noexcept;
+void select_from_to_sql(const dynamic::SelectFrom& _stmt,
+                        std::string* _out) noexcept;
 
-std::string table_or_query_to_sql(
-    const dynamic::SelectFrom::TableOrQueryType& _table_or_query) noexcept;
+void table_or_query_to_sql(
+    const dynamic::SelectFrom::TableOrQueryType& _table_or_query,
+    std::string* _out) noexcept;
 
 std::string type_to_sql(const dynamic::Type& _type) noexcept;
 
-std::string update_to_sql(const dynamic::Update& _stmt) noexcept;
+void update_to_sql(const dynamic::Update& _stmt, std::string* _out) noexcept;
 
-std::string write_to_sql(const dynamic::Write& _stmt) noexcept;
+void write_to_sql(const dynamic::Write& _stmt, std::string* _out) noexcept;
 
 // ----------------------------------------------------------------------------
 
@@ -85,349 +96,379 @@ inline std::string wrap_in_quotes(const std::string& _name) noexcept {
   return "\"" + _name + "\"";
 }
 
-inline std::string wrap_in_single_quotes(const std::string& _name) noexcept {
-  return "'" + _name + "'";
+inline void wrap_in_quotes(const std::string& _name,
+                           std::string* _out) noexcept {
+  _out->push_back('"');
+  _out->append(_name);
+  _out->push_back('"');
+}
+
+inline void wrap_in_single_quotes(const std::string& _name,
+                                  std::string* _out) noexcept {
+  _out->push_back('\'');
+  _out->append(_name);
+  _out->push_back('\'');
+}
+
+inline void table_to_sql(const dynamic::Table& _table,
+                         std::string* _out) noexcept {
+  if (_table.schema) {
+    wrap_in_quotes(*_table.schema, _out);
+    _out->push_back('.');
+  }
+  wrap_in_quotes(_table.name, _out);
+}
+
+/// Writes "<_prefix><op1><_infix><op2><_suffix>".
+inline void binary_operation_to_sql(const std::string_view _prefix,
+                                    const dynamic::Operation& _op1,
+                                    const std::string_view _infix,
+                                    const dynamic::Operation& _op2,
+                                    const std::string_view _suffix,
+                                    std::string* _out) noexcept {
+  _out->append(_prefix);
+  operation_to_sql(_op1, _out);
+  _out->append(_infix);
+  operation_to_sql(_op2, _out);
+  _out->append(_suffix);
+}
+
+/// Writes "<_prefix><op><_suffix>".
+inline void unary_operation_to_sql(const std::string_view _prefix,
+                                   const dynamic::Operation& _op,
+                                   const std::string_view _suffix,
+                                   std::string* _out) noexcept {
+  _out->append(_prefix);
+  operation_to_sql(_op, _out);
+  _out->append(_suffix);
 }
 
 // ----------------------------------------------------------------------------
 
-std::string aggregation_to_sql(
-    const dynamic::Aggregation& _aggregation) noexcept {
-  return _aggregation.val.visit([](const auto& _agg) -> std::string {
+void aggregation_to_sql(const dynamic::Aggregation& _aggregation,
+                        std::string* _out) noexcept {
+  _aggregation.val.visit([&](const auto& _agg) {
     using Type = std::remove_cvref_t<decltype(_agg)>;
-    std::stringstream stream;
     if constexpr (std::is_same_v<Type, dynamic::Aggregation::Avg>) {
-      stream << "AVG(" << operation_to_sql(*_agg.val) << ")";
+      unary_operation_to_sql("AVG(", *_agg.val, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Aggregation::Count>) {
-      const auto val =
-          std::string(_agg.val && _agg.distinct ? "DISTINCT " : "") +
-          (_agg.val ? column_or_value_to_sql(*_agg.val) : std::string("*"));
-      stream << "COUNT(" << val << ")";
+      _out->append("COUNT(");
+      if (_agg.val) {
+        if (_agg.distinct) {
+          _out->append("DISTINCT ");
+        }
+        column_or_value_to_sql(*_agg.val, _out);
+      } else {
+        _out->push_back('*');
+      }
+      _out->push_back(')');
 
     } else if constexpr (std::is_same_v<Type, dynamic::Aggregation::Max>) {
-      stream << "MAX(" << operation_to_sql(*_agg.val) << ")";
+      unary_operation_to_sql("MAX(", *_agg.val, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Aggregation::Min>) {
-      stream << "MIN(" << operation_to_sql(*_agg.val) << ")";
+      unary_operation_to_sql("MIN(", *_agg.val, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Aggregation::Sum>) {
-      stream << "SUM(" << operation_to_sql(*_agg.val) << ")";
+      unary_operation_to_sql("SUM(", *_agg.val, ")", _out);
 
     } else {
       static_assert(rfl::always_false_v<Type>, "Not all cases were covered.");
     }
-    return stream.str();
   });
 }
 
-std::string column_or_value_to_sql(
-    const dynamic::ColumnOrValue& _col) noexcept {
-  const auto handle_value = [](const auto& _v) -> std::string {
+void column_or_value_to_sql(const dynamic::ColumnOrValue& _col,
+                            std::string* _out) noexcept {
+  const auto handle_value = [&](const auto& _v) {
     using Type = std::remove_cvref_t<decltype(_v)>;
     if constexpr (std::is_same_v<Type, dynamic::String>) {
-      return "'" + escape_single_quote(_v.val) + "'";
+      _out->push_back('\'');
+      escape_single_quote(_v.val, _out);
+      _out->push_back('\'');
 
     } else if constexpr (std::is_same_v<Type, dynamic::Duration>) {
-      return "INTERVAL '" + std::to_string(_v.val) + " " +
-             rfl::enum_to_string(_v.unit) + "'";
+      _out->append("INTERVAL '");
+      _out->append(std::to_string(_v.val));
+      _out->push_back(' ');
+      _out->append(rfl::enum_to_string(_v.unit));
+      _out->push_back('\'');
 
     } else if constexpr (std::is_same_v<Type, dynamic::Timestamp>) {
-      return "to_timestamp(" + std::to_string(_v.seconds_since_unix) + ")";
+      _out->append("to_timestamp(");
+      _out->append(std::to_string(_v.seconds_since_unix));
+      _out->push_back(')');
 
     } else if constexpr (std::is_same_v<Type, dynamic::Boolean>) {
-      return _v.val ? "TRUE" : "FALSE";
+      _out->append(_v.val ? "TRUE" : "FALSE");
 
     } else {
-      return std::to_string(_v.val);
+      _out->append(std::to_string(_v.val));
     }
   };
 
-  return _col.visit([&](const auto& _c) -> std::string {
+  _col.visit([&](const auto& _c) {
     using Type = std::remove_cvref_t<decltype(_c)>;
     if constexpr (std::is_same_v<Type, dynamic::Column>) {
       if (_c.alias) {
-        return *_c.alias + "." + wrap_in_quotes(_c.name);
-      } else {
-        return wrap_in_quotes(_c.name);
+        _out->append(*_c.alias);
+        _out->push_back('.');
       }
+      wrap_in_quotes(_c.name, _out);
     } else {
-      return _c.val.visit(handle_value);
+      _c.val.visit(handle_value);
     }
   });
 }
 
-std::string condition_to_sql(const dynamic::Condition& _cond) noexcept {
-  return _cond.val.visit(
-      [&](const auto& _c) { return condition_to_sql_impl(_c); });
+void condition_to_sql(const dynamic::Condition& _cond,
+                      std::string* _out) noexcept {
+  _cond.val.visit([&](const auto& _c) { condition_to_sql_impl(_c, _out); });
 }
 
 template <class ConditionType>
-std::string condition_to_sql_impl(const ConditionType& _condition) noexcept {
-  using namespace std::ranges::views;
-
+void condition_to_sql_impl(const ConditionType& _condition,
+                           std::string* _out) noexcept {
   using C = std::remove_cvref_t<ConditionType>;
 
-  std::stringstream stream;
+  const auto value_to_sql = [](const dynamic::Value& _v, std::string* _o) {
+    column_or_value_to_sql(_v, _o);
+  };
 
   if constexpr (std::is_same_v<C, dynamic::Condition::And>) {
-    stream << "(" << condition_to_sql(*_condition.cond1) << ") AND ("
-           << condition_to_sql(*_condition.cond2) << ")";
+    _out->push_back('(');
+    condition_to_sql(*_condition.cond1, _out);
+    _out->append(") AND (");
+    condition_to_sql(*_condition.cond2, _out);
+    _out->push_back(')');
 
   } else if constexpr (std::is_same_v<
                            C, dynamic::Condition::BooleanColumnOrValue>) {
-    stream << column_or_value_to_sql(_condition.col_or_val);
+    column_or_value_to_sql(_condition.col_or_val, _out);
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::Equal>) {
-    stream << operation_to_sql(_condition.op1) << " = "
-           << operation_to_sql(_condition.op2);
+    binary_operation_to_sql("", _condition.op1, " = ", _condition.op2, "",
+                            _out);
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::GreaterEqual>) {
-    stream << operation_to_sql(_condition.op1)
-           << " >= " << operation_to_sql(_condition.op2);
+    binary_operation_to_sql("", _condition.op1, " >= ", _condition.op2, "",
+                            _out);
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::GreaterThan>) {
-    stream << operation_to_sql(_condition.op1) << " > "
-           << operation_to_sql(_condition.op2);
+    binary_operation_to_sql("", _condition.op1, " > ", _condition.op2, "",
+                            _out);
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::In>) {
-    stream << operation_to_sql(_condition.op) << " IN ("
-           << internal::strings::join(
-                  ", ",
-                  internal::collect::vector(_condition.patterns |
-                                            transform(column_or_value_to_sql)))
-           << ")";
+    operation_to_sql(_condition.op, _out);
+    _out->append(" IN (");
+    internal::strings::join_into(", ", _condition.patterns, value_to_sql, _out);
+    _out->push_back(')');
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::IsNull>) {
-    stream << operation_to_sql(_condition.op) << " IS NULL";
+    operation_to_sql(_condition.op, _out);
+    _out->append(" IS NULL");
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::IsNotNull>) {
-    stream << operation_to_sql(_condition.op) << " IS NOT NULL";
+    operation_to_sql(_condition.op, _out);
+    _out->append(" IS NOT NULL");
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::LesserEqual>) {
-    stream << operation_to_sql(_condition.op1)
-           << " <= " << operation_to_sql(_condition.op2);
+    binary_operation_to_sql("", _condition.op1, " <= ", _condition.op2, "",
+                            _out);
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::LesserThan>) {
-    stream << operation_to_sql(_condition.op1) << " < "
-           << operation_to_sql(_condition.op2);
+    binary_operation_to_sql("", _condition.op1, " < ", _condition.op2, "",
+                            _out);
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::Like>) {
-    stream << operation_to_sql(_condition.op) << " LIKE "
-           << column_or_value_to_sql(_condition.pattern);
+    operation_to_sql(_condition.op, _out);
+    _out->append(" LIKE ");
+    column_or_value_to_sql(_condition.pattern, _out);
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::Not>) {
-    stream << "NOT (" << condition_to_sql(*_condition.cond) << ")";
+    _out->append("NOT (");
+    condition_to_sql(*_condition.cond, _out);
+    _out->push_back(')');
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::NotEqual>) {
-    stream << operation_to_sql(_condition.op1)
-           << " != " << operation_to_sql(_condition.op2);
+    binary_operation_to_sql("", _condition.op1, " != ", _condition.op2, "",
+                            _out);
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::NotLike>) {
-    stream << operation_to_sql(_condition.op) << " NOT LIKE "
-           << column_or_value_to_sql(_condition.pattern);
+    operation_to_sql(_condition.op, _out);
+    _out->append(" NOT LIKE ");
+    column_or_value_to_sql(_condition.pattern, _out);
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::NotIn>) {
-    stream << operation_to_sql(_condition.op) << " NOT IN ("
-           << internal::strings::join(
-                  ", ",
-                  internal::collect::vector(_condition.patterns |
-                                            transform(column_or_value_to_sql)))
-           << ")";
+    operation_to_sql(_condition.op, _out);
+    _out->append(" NOT IN (");
+    internal::strings::join_into(", ", _condition.patterns, value_to_sql, _out);
+    _out->push_back(')');
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::Or>) {
-    stream << "(" << condition_to_sql(*_condition.cond1) << ") OR ("
-           << condition_to_sql(*_condition.cond2) << ")";
+    _out->push_back('(');
+    condition_to_sql(*_condition.cond1, _out);
+    _out->append(") OR (");
+    condition_to_sql(*_condition.cond2, _out);
+    _out->push_back(')');
 
   } else {
     static_assert(rfl::always_false_v<C>, "Not all cases were covered.");
   }
-  return stream.str();
 }
 
-std::string column_to_sql_definition(const dynamic::Column& _col) noexcept {
-  return wrap_in_quotes(_col.name) + " " + type_to_sql(_col.type) +
-         properties_to_sql(
-             _col.type.visit([](const auto& _t) { return _t.properties; }));
+void column_to_sql_definition(const dynamic::Column& _col,
+                              std::string* _out) noexcept {
+  wrap_in_quotes(_col.name, _out);
+  _out->push_back(' ');
+  _out->append(type_to_sql(_col.type));
+  properties_to_sql(
+      _col.type.visit([](const auto& _t) { return _t.properties; }), _out);
 }
 
-std::string create_index_to_sql(const dynamic::CreateIndex& _stmt) noexcept {
-  using namespace std::ranges::views;
-
-  std::stringstream stream;
-
+void create_index_to_sql(const dynamic::CreateIndex& _stmt,
+                         std::string* _out) noexcept {
   if (_stmt.unique) {
-    stream << "CREATE UNIQUE INDEX ";
+    _out->append("CREATE UNIQUE INDEX ");
   } else {
-    stream << "CREATE INDEX ";
+    _out->append("CREATE INDEX ");
   }
 
   if (_stmt.if_not_exists) {
-    stream << "IF NOT EXISTS ";
+    _out->append("IF NOT EXISTS ");
   }
 
-  stream << "\"" << _stmt.name << "\" ";
+  wrap_in_quotes(_stmt.name, _out);
+  _out->append(" ON ");
 
-  stream << "ON ";
-
-  if (_stmt.table.schema) {
-    stream << "\"" << *_stmt.table.schema << "\".";
-  }
-  stream << "\"" << _stmt.table.name << "\"";
+  table_to_sql(_stmt.table, _out);
 
-  stream << "(";
-  stream << internal::strings::join(
-      ", ",
-      internal::collect::vector(_stmt.columns | transform(wrap_in_quotes)));
-  stream << ")";
+  _out->push_back('(');
+  internal::strings::join_into(
+      ", ", _stmt.columns,
+      [](const std::string& _c, std::string* _o) { wrap_in_quotes(_c, _o); },
+      _out);
+  _out->push_back(')');
 
   if (_stmt.where) {
-    stream << " WHERE " << condition_to_sql(*_stmt.where);
+    _out->append(" WHERE ");
+    condition_to_sql(*_stmt.where, _out);
   }
 
-  stream << ";";
-
-  return stream.str();
+  _out->push_back(';');
 }
 
-std::string create_table_to_sql(const dynamic::CreateTable& _stmt) noexcept {
-  using namespace std::ranges::views;
-
-  const auto col_to_sql = [&](const auto& _col) {
-    return column_to_sql_definition(_col);
-  };
-
-  std::stringstream stream;
-
+void create_table_to_sql(const dynamic::CreateTable& _stmt,
+                         std::string* _out) noexcept {
   for (const auto& [enum_name, enum_values] : get_enum_types(_stmt)) {
     if (_stmt.if_not_exists) {
-      stream << "DO $$ BEGIN ";
+      _out->append("DO $$ BEGIN ");
     }
-    stream << "CREATE TYPE " << enum_name << " AS ENUM ("
-           << internal::strings::join(
-                  ", ", internal::collect::vector(
-                            enum_values | transform(wrap_in_single_quotes)))
-           << "); ";
+    _out->append("CREATE TYPE ");
+    _out->append(enum_name);
+    _out->append(" AS ENUM (");
+    internal::strings::join_into(", ", enum_values, wrap_in_single_quotes,
+                                 _out);
+    _out->append("); ");
     if (_stmt.if_not_exists) {
-      stream << "EXCEPTION WHEN duplicate_object THEN NULL; END $$;";
+      _out->append("EXCEPTION WHEN duplicate_object THEN NULL; END $$;");
     }
   }
 
-  stream << "CREATE TABLE ";
+  _out->append("CREATE TABLE ");
 
   if (_stmt.if_not_exists) {
-    stream << "IF NOT EXISTS ";
+    _out->append("IF NOT EXISTS ");
   }
 
-  if (_stmt.table.schema) {
-    stream << wrap_in_quotes(*_stmt.table.schema) << ".";
-  }
-  stream << wrap_in_quotes(_stmt.table.name) << " ";
+  table_to_sql(_stmt.table, _out);
 
-  stream << "(";
-  stream << internal::strings::join(
-      ", ", internal::collect::vector(_stmt.columns | transform(col_to_sql)));
+  _out->append(" (");
+  internal::strings::join_into(", ", _stmt.columns, column_to_sql_definition,
+                               _out);
 
   const auto primary_keys = get_primary_keys(_stmt);
 
   if (primary_keys.size() != 0) {
-    stream << ", PRIMARY KEY (" << internal::strings::join(", ", primary_keys)
-           << ")";
+    _out->append(", PRIMARY KEY (");
+    internal::strings::join_into(
+        ", ", primary_keys,
+        [](const std::string& _pk, std::string* _o) { _o->append(_pk); },
+        _out);
+    _out->push_back(')');
   }
 
-  stream << ");";
-
-  return stream.str();
+  _out->append(");");
 }
 
-std::string create_as_to_sql(const dynamic::CreateAs& _stmt) noexcept {
-  std::stringstream stream;
-
-  stream << "CREATE ";
+void create_as_to_sql(const dynamic::CreateAs& _stmt,
+                      std::string* _out) noexcept {
+  _out->append("CREATE ");
 
   if (_stmt.or_replace) {
-    stream << "OR REPLACE ";
+    _out->append("OR REPLACE ");
   }
 
-  stream << internal::strings::replace_all(
-                internal::strings::to_upper(rfl::enum_to_string(_stmt.what)),
-                "_", " ")
-         << " ";
+  _out->append(internal::strings::replace_all(
+      internal::strings::to_upper(rfl::enum_to_string(_stmt.what)), "_", " "));
+  _out->push_back(' ');
 
   if (_stmt.if_not_exists) {
-    stream << "IF NOT EXISTS ";
-  }
-
-  if (_stmt.table_or_view.schema) {
-    stream << wrap_in_quotes(*_stmt.table_or_view.schema) << ".";
+    _out->append("IF NOT EXISTS ");
   }
-  stream << wrap_in_quotes(_stmt.table_or_view.name) << " AS ";
 
-  stream << select_from_to_sql(_stmt.query);
+  table_to_sql(_stmt.table_or_view, _out);
+  _out->append(" AS ");
 
-  return stream.str();
+  select_from_to_sql(_stmt.query, _out);
 }
 
-std::string delete_from_to_sql(const dynamic::DeleteFrom& _stmt) noexcept {
-  std::stringstream stream;
-
-  stream << "DELETE FROM ";
+void delete_from_to_sql(const dynamic::DeleteFrom& _stmt,
+                        std::string* _out) noexcept {
+  _out->append("DELETE FROM ");
 
-  if (_stmt.table.schema) {
-    stream << wrap_in_quotes(*_stmt.table.schema) << ".";
-  }
-  stream << wrap_in_quotes(_stmt.table.name);
+  table_to_sql(_stmt.table, _out);
 
   if (_stmt.where) {
-    stream << " WHERE " << condition_to_sql(*_stmt.where);
+    _out->append(" WHERE ");
+    condition_to_sql(*_stmt.where, _out);
   }
 
-  stream << ";";
-
-  return stream.str();
+  _out->push_back(';');
 }
 
-std::string drop_to_sql(const dynamic::Drop& _stmt) noexcept {
-  std::stringstream stream;
-
-  stream << "DROP "
-         << internal::strings::replace_all(
-                internal::strings::to_upper(rfl::enum_to_string(_stmt.what)),
-                "_", " ")
-         << " ";
+void drop_to_sql(const dynamic::Drop& _stmt, std::string* _out) noexcept {
+  _out->append("DROP ");
+  _out->append(internal::strings::replace_all(
+      internal::strings::to_upper(rfl::enum_to_string(_stmt.what)), "_", " "));
+  _out->push_back(' ');
 
   if (_stmt.if_exists) {
-    stream << "IF EXISTS ";
+    _out->append("IF EXISTS ");
   }
 
-  if (_stmt.table.schema) {
-    stream << wrap_in_quotes(*_stmt.table.schema) << ".";
-  }
-  stream << wrap_in_quotes(_stmt.table.name);
+  table_to_sql(_stmt.table, _out);
 
   if (_stmt.cascade) {
-    stream << " CASCADE";
+    _out->append(" CASCADE");
   }
 
-  stream << ";";
-
-  return stream.str();
+  _out->push_back(';');
 }
 
-std::string escape_single_quote(const std::string& _str) noexcept {
-  return internal::strings::replace_all(_str, "'", "''");
+void escape_single_quote(const std::string& _str, std::string* _out) noexcept {
+  internal::strings::append_replace_all(_str, '\'', "''", _out);
 }
 
-std::string field_to_str(const dynamic::SelectFrom::Field& _field) noexcept {
-  std::stringstream stream;
-
-  stream << operation_to_sql(_field.val);
+void field_to_str(const dynamic::SelectFrom::Field& _field,
+                  std::string* _out) noexcept {
+  operation_to_sql(_field.val, _out);
 
   if (_field.as) {
-    stream << " AS " << wrap_in_quotes(*_field.as);
+    _out->append(" AS ");
+    wrap_in_quotes(*_field.as, _out);
   }
-
-  return stream.str();
 }
 
 std::vector<std::string> get_primary_keys(
@@ -441,7 +482,9 @@ std::vector<std::string> get_primary_keys(
 
   return internal::collect::vector(_stmt.columns | filter(is_primary_key) |
                                    transform(get_name) |
-                                   transform(wrap_in_quotes));
+                                   transform([](const std::string& _name) {
+                                     return wrap_in_quotes(_name);
+                                   }));
 }
 
 std::vector<std::pair<std::string, std::vector<std::string>>> get_enum_types(
@@ -458,346 +501,340 @@ std::vector<std::pair<std::string, std::vector<std::string>>> get_enum_types(
                                    transform(get_enum_mapping));
 }
 
-std::string insert_to_sql(const dynamic::Insert& _stmt) noexcept {
+void insert_to_sql(const dynamic::Insert& _stmt, std::string* _out) noexcept {
   using namespace std::ranges::views;
 
-  const auto to_placeholder = [](const size_t _i) -> std::string {
-    return "$" + std::to_string(_i + 1);
+  const auto to_placeholder = [](const size_t _i, std::string* _o) {
+    _o->push_back('$');
+    _o->append(std::to_string(_i + 1));
   };
 
-  const auto as_excluded = [](const std::string& _str) -> std::string {
-    return _str + "=excluded." + _str;
+  const auto as_excluded = [](const std::string& _str, std::string* _o) {
+    _o->append(_str);
+    _o->append("=excluded.");
+    _o->append(_str);
   };
 
-  std::stringstream stream;
-  stream << "INSERT INTO ";
-  if (_stmt.table.schema) {
-    stream << wrap_in_quotes(*_stmt.table.schema) << ".";
-  }
-  stream << wrap_in_quotes(_stmt.table.name);
+  _out->append("INSERT INTO ");
+  table_to_sql(_stmt.table, _out);
 
-  stream << " (";
-  stream << internal::strings::join(
-      ", ",
-      internal::collect::vector(_stmt.columns | transform(wrap_in_quotes)));
-  stream << ")";
+  _out->append(" (");
+  internal::strings::join_into(
+      ", ", _stmt.columns,
+      [](const std::string& _c, std::string* _o) { wrap_in_quotes(_c, _o); },
+      _out);
+  _out->push_back(')');
 
-  stream << " VALUES (";
-  stream << internal::strings::join(
-      ", ", internal::collect::vector(
-                iota(static_cast<size_t>(0), _stmt.columns.size()) |
-                transform(to_placeholder)));
-  stream << ")";
+  _out->append(" VALUES (");
+  internal::strings::join_into(
+      ", ", iota(static_cast<size_t>(0), _stmt.columns.size()), to_placeholder,
+      _out);
+  _out->push_back(')');
 
   if (_stmt.or_replace) {
-    stream << " ON CONFLICT (";
-    stream << internal::strings::join(
-        ", ", internal::collect::vector(_stmt.constraints));
-    stream << ")";
-
-    stream << " DO UPDATE SET ";
-    stream << internal::strings::join(
-        ", ",
-        internal::collect::vector(_stmt.columns | transform(as_excluded)));
+    _out->append(" ON CONFLICT (");
+    internal::strings::join_into(
+        ", ", _stmt.constraints,
+        [](const std::string& _c, std::string* _o) { _o->append(_c); }, _out);
+    _out->push_back(')');
+
+    _out->append(" DO UPDATE SET ");
+    internal::strings::join_into(", ", _stmt.columns, as_excluded, _out);
   }
 
-  stream << ";";
-  return stream.str();
+  _out->push_back(';');
 }
 
-std::string join_to_sql(const dynamic::Join& _stmt) noexcept {
-  std::stringstream stream;
-
-  stream << internal::strings::to_upper(internal::strings::replace_all(
-                rfl::enum_to_string(_stmt.how), "_", " "))
-         << " " << table_or_query_to_sql(_stmt.table_or_query) << " "
-         << _stmt.alias << " ";
+void join_to_sql(const dynamic::Join& _stmt, std::string* _out) noexcept {
+  _out->append(internal::strings::to_upper(internal::strings::replace_all(
+      rfl::enum_to_string(_stmt.how), "_", " ")));
+  _out->push_back(' ');
+  table_or_query_to_sql(_stmt.table_or_query, _out);
+  _out->push_back(' ');
+  _out->append(_stmt.alias);
+  _out->push_back(' ');
 
   if (_stmt.on) {
-    stream << "ON " << condition_to_sql(*_stmt.on);
+    _out->append("ON ");
+    condition_to_sql(*_stmt.on, _out);
   } else {
-    stream << "ON 1 = 1";
+    _out->append("ON 1 = 1");
   }
-
-  return stream.str();
 }
 
-std::string operation_to_sql(const dynamic::Operation& _stmt) noexcept {
-  using namespace std::ranges::views;
-  return _stmt.val.visit([](const auto& _s) -> std::string {
-    using Type = std::remove_cvref_t<decltype(_s)>;
+void operation_to_sql(const dynamic::Operation& _stmt,
+                      std::string* _out) noexcept {
+  const auto ref_to_sql = [](const auto& _op, std::string* _o) {
+    operation_to_sql(*_op, _o);
+  };
 
-    std::stringstream stream;
+  _stmt.val.visit([&](const auto& _s) {
+    using Type = std::remove_cvref_t<decltype(_s)>;
 
     if constexpr (std::is_same_v<Type, dynamic::Operation::Abs>) {
-      stream << "abs(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("abs(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Aggregation>) {
-      stream << aggregation_to_sql(_s);
+      aggregation_to_sql(_s, _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Cast>) {
-      stream << "cast(" << operation_to_sql(*_s.op1) << " as "
-             << type_to_sql(_s.target_type) << ")";
+      unary_operation_to_sql("cast(", *_s.op1, " as ", _out);
+      _out->append(type_to_sql(_s.target_type));
+      _out->push_back(')');
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Coalesce>) {
-      stream << "coalesce("
-             << internal::strings::join(
-                    ", ", internal::collect::vector(
-                              _s.ops | transform([](const auto& _op) {
-                                return operation_to_sql(*_op);
-                              })))
-             << ")";
+      _out->append("coalesce(");
+      internal::strings::join_into(", ", _s.ops, ref_to_sql, _out);
+      _out->push_back(')');
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Ceil>) {
-      stream << "ceil(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("ceil(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Column>) {
-      stream << column_or_value_to_sql(_s);
+      column_or_value_to_sql(_s, _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Concat>) {
-      stream << "("
-             << internal::strings::join(
-                    " || ", internal::collect::vector(
-                                _s.ops | transform([](const auto& _op) {
-                                  return operation_to_sql(*_op);
-                                })))
-             << ")";
+      _out->push_back('(');
+      internal::strings::join_into(" || ", _s.ops, ref_to_sql, _out);
+      _out->push_back(')');
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Cos>) {
-      stream << "cos(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("cos(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type,
                                         dynamic::Operation::DatePlusDuration>) {
-      stream << operation_to_sql(*_s.date) << " + "
-             << internal::strings::join(
-                    " + ",
-                    internal::collect::vector(
-                        _s.durations | transform([](const auto& _d) {
-                          return column_or_value_to_sql(dynamic::Value{_d});
-                        })));
+      operation_to_sql(*_s.date, _out);
+      _out->append(" + ");
+      internal::strings::join_into(
+          " + ", _s.durations,
+          [](const auto& _d, std::string* _o) {
+            column_or_value_to_sql(dynamic::Value{_d}, _o);
+          },
+          _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Day>) {
-      stream << "extract(DAY from " << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("extract(DAY from ", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type,
                                         dynamic::Operation::DaysBetween>) {
-      stream << "cast(" << operation_to_sql(*_s.op2) << " as DATE) - cast("
-             << operation_to_sql(*_s.op1) << " as DATE)";
+      binary_operation_to_sql("cast(", *_s.op2, " as DATE) - cast(", *_s.op1,
+                              " as DATE)", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Divides>) {
-      stream << "(" << operation_to_sql(*_s.op1) << ") / ("
-             << operation_to_sql(*_s.op2) << ")";
+      binary_operation_to_sql("(", *_s.op1, ") / (", *_s.op2, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Exp>) {
-      stream << "exp(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("exp(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Floor>) {
-      stream << "floor(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("floor(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Hour>) {
-      stream << "extract(HOUR from " << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("extract(HOUR from ", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Length>) {
-      stream << "length(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("length(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Ln>) {
-      stream << "ln(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("ln(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Log2>) {
-      stream << "log(2.0, " << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("log(2.0, ", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Lower>) {
-      stream << "lower(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("lower(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::LTrim>) {
-      stream << "ltrim(" << operation_to_sql(*_s.op1) << ", "
-             << operation_to_sql(*_s.op2) << ")";
+      binary_operation_to_sql("ltrim(", *_s.op1, ", ", *_s.op2, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Minus>) {
-      stream << "(" << operation_to_sql(*_s.op1) << ") - ("
-             << operation_to_sql(*_s.op2) << ")";
+      binary_operation_to_sql("(", *_s.op1, ") - (", *_s.op2, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Minute>) {
-      stream << "extract(MINUTE from " << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("extract(MINUTE from ", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Mod>) {
-      stream << "mod(" << operation_to_sql(*_s.op1) << ", "
-             << operation_to_sql(*_s.op2) << ")";
+      binary_operation_to_sql("mod(", *_s.op1, ", ", *_s.op2, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Month>) {
-      stream << "extract(MONTH from " << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("extract(MONTH from ", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Multiplies>) {
-      stream << "(" << operation_to_sql(*_s.op1) << ") * ("
-             << operation_to_sql(*_s.op2) << ")";
+      binary_operation_to_sql("(", *_s.op1, ") * (", *_s.op2, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Plus>) {
-      stream << "(" << operation_to_sql(*_s.op1) << ") + ("
-             << operation_to_sql(*_s.op2) << ")";
+      binary_operation_to_sql("(", *_s.op1, ") + (", *_s.op2, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Replace>) {
-      stream << "replace(" << operation_to_sql(*_s.op1) << ", "
-             << operation_to_sql(*_s.op2) << ", " << operation_to_sql(*_s.op3)
-             << ")";
+      binary_operation_to_sql("replace(", *_s.op1, ", ", *_s.op2, ", ", _out);
+      unary_operation_to_sql("", *_s.op3, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Round>) {
-      stream << "round(" << operation_to_sql(*_s.op1) << ", "
-             << operation_to_sql(*_s.op2) << ")";
+      binary_operation_to_sql("round(", *_s.op1, ", ", *_s.op2, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::RTrim>) {
-      stream << "rtrim(" << operation_to_sql(*_s.op1) << ", "
-             << operation_to_sql(*_s.op2) << ")";
+      binary_operation_to_sql("rtrim(", *_s.op1, ", ", *_s.op2, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Second>) {
-      stream << "extract(SECOND from " << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("extract(SECOND from ", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Sin>) {
-      stream << "sin(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("sin(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Sqrt>) {
-      stream << "sqrt(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("sqrt(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Tan>) {
-      stream << "tan(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("tan(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Trim>) {
-      stream << "trim(" << operation_to_sql(*_s.op1) << ", "
-             << operation_to_sql(*_s.op2) << ")";
+      binary_operation_to_sql("trim(", *_s.op1, ", ", *_s.op2, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Unixepoch>) {
-      stream << "extract(EPOCH FROM " << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("extract(EPOCH FROM ", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Upper>) {
-      stream << "upper(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("upper(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Value>) {
-      stream << column_or_value_to_sql(_s);
+      column_or_value_to_sql(_s, _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Weekday>) {
-      stream << "extract(DOW from " << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("extract(DOW from ", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Year>) {
-      stream << "extract(YEAR from " << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("extract(YEAR from ", *_s.op1, ")", _out);
 
     } else {
       static_assert(rfl::always_false_v<Type>, "Unsupported type.");
     }
-    return stream.str();
   });
 }
 
-std::string properties_to_sql(const dynamic::types::Properties& _p) noexcept {
-  return [&]() -> std::string {
-    return std::string(_p.auto_incr ? " GENERATED ALWAYS AS IDENTITY" : "") +
-           std::string(_p.nullable ? "" : " NOT NULL") +
-           std::string(_p.unique ? " UNIQUE" : "");
-  }() + [&]() -> std::string {
-    if (!_p.foreign_key_reference) {
-      return "";
-    }
+void properties_to_sql(const dynamic::types::Properties& _p,
+                       std::string* _out) noexcept {
+  if (_p.auto_incr) {
+    _out->append(" GENERATED ALWAYS AS IDENTITY");
+  }
+  if (!_p.nullable) {
+    _out->append(" NOT NULL");
+  }
+  if (_p.unique) {
+    _out->append(" UNIQUE");
+  }
+  if (_p.foreign_key_reference) {
     const auto& ref = *_p.foreign_key_reference;
-    return " REFERENCES " + wrap_in_quotes(ref.table) + "(" +
-           wrap_in_quotes(ref.column) + ")";
-  }();
+    _out->append(" REFERENCES ");
+    wrap_in_quotes(ref.table, _out);
+    _out->push_back('(');
+    wrap_in_quotes(ref.column, _out);
+    _out->push_back(')');
+  }
 }
 
-std::string select_from_to_sql(const dynamic::SelectFrom& _stmt) noexcept {
-  using namespace std::ranges::views;
-
-  const auto order_by_to_str = [](const auto& _w) -> std::string {
-    return column_or_value_to_sql(_w.column) + (_w.desc ? " DESC" : "");
+void select_from_to_sql(const dynamic::SelectFrom& _stmt,
+                        std::string* _out) noexcept {
+  const auto column_to_sql = [](const dynamic::Column& _c, std::string* _o) {
+    column_or_value_to_sql(_c, _o);
   };
 
-  std::stringstream stream;
+  const auto order_by_to_str = [](const auto& _w, std::string* _o) {
+    column_or_value_to_sql(_w.column, _o);
+    if (_w.desc) {
+      _o->append(" DESC");
+    }
+  };
 
-  stream << "SELECT ";
-  stream << internal::strings::join(
-      ", ", internal::collect::vector(_stmt.fields | transform(field_to_str)));
+  _out->append("SELECT ");
+  internal::strings::join_into(", ", _stmt.fields, field_to_str, _out);
 
-  stream << " FROM " << table_or_query_to_sql(_stmt.table_or_query);
+  _out->append(" FROM ");
+  table_or_query_to_sql(_stmt.table_or_query, _out);
 
   if (_stmt.alias) {
-    stream << " " << *_stmt.alias;
+    _out->push_back(' ');
+    _out->append(*_stmt.alias);
   }
 
   if (_stmt.joins) {
-    stream << " "
-           << internal::strings::join(
-                  " ", internal::collect::vector(*_stmt.joins |
-                                                 transform(join_to_sql)));
+    _out->push_back(' ');
+    internal::strings::join_into(" ", *_stmt.joins, join_to_sql, _out);
   }
 
   if (_stmt.where) {
-    stream << " WHERE " << condition_to_sql(*_stmt.where);
+    _out->append(" WHERE ");
+    condition_to_sql(*_stmt.where, _out);
   }
 
   if (_stmt.group_by) {
-    stream << " GROUP BY "
-           << internal::strings::join(
-                  ", ",
-                  internal::collect::vector(_stmt.group_by->columns |
-                                            transform(column_or_value_to_sql)));
+    _out->append(" GROUP BY ");
+    internal::strings::join_into(", ", _stmt.group_by->columns, column_to_sql,
+                                 _out);
   }
 
   if (_stmt.order_by) {
-    stream << " ORDER BY "
-           << internal::strings::join(
-                  ", ", internal::collect::vector(_stmt.order_by->columns |
-                                                  transform(order_by_to_str)));
+    _out->append(" ORDER BY ");
+    internal::strings::join_into(", ", _stmt.order_by->columns,
+                                 order_by_to_str, _out);
   }
 
   if (_stmt.limit) {
-    stream << " LIMIT " << _stmt.limit->val;
+    _out->append(" LIMIT ");
+    _out->append(std::to_string(_stmt.limit->val));
   }
-
-  return stream.str();
 }
 
-std::string table_or_query_to_sql(
-    const dynamic::SelectFrom::TableOrQueryType& _table_or_query) noexcept {
-  return _table_or_query.visit([](const auto& _t) -> std::string {
+void table_or_query_to_sql(
+    const dynamic::SelectFrom::TableOrQueryType& _table_or_query,
+    std::string* _out) noexcept {
+  _table_or_query.visit([&](const auto& _t) {
     using Type = std::remove_cvref_t<decltype(_t)>;
     if constexpr (std::is_same_v<Type, dynamic::Table>) {
-      if (_t.schema) {
-        return wrap_in_quotes(*_t.schema) + "." + wrap_in_quotes(_t.name);
-      }
-      return wrap_in_quotes(_t.name);
+      table_to_sql(_t, _out);
     } else {
-      return "(" + select_from_to_sql(*_t) + ")";
+      _out->push_back('(');
+      select_from_to_sql(*_t, _out);
+      _out->push_back(')');
     }
   });
 }
 
 std::string to_sql_impl(const dynamic::Statement& _stmt) noexcept {
-  return _stmt.visit([&](const auto& _s) -> std::string {
+  std::string sql;
+  to_sql_into(_stmt, &sql);
+  return sql;
+}
+
+void to_sql_into(const dynamic::Statement& _stmt, std::string* _out) noexcept {
+  _stmt.visit([&](const auto& _s) {
     using S = std::remove_cvref_t<decltype(_s)>;
 
     if constexpr (std::is_same_v<S, dynamic::CreateIndex>) {
-      return create_index_to_sql(_s);
+      create_index_to_sql(_s, _out);
 
     } else if constexpr (std::is_same_v<S, dynamic::CreateTable>) {
-      return create_table_to_sql(_s);
+      create_table_to_sql(_s, _out);
 
     } else if constexpr (std::is_same_v<S, dynamic::CreateAs>) {
-      return create_as_to_sql(_s);
+      create_as_to_sql(_s, _out);
 
     } else if constexpr (std::is_same_v<S, dynamic::DeleteFrom>) {
-      return delete_from_to_sql(_s);
+      delete_from_to_sql(_s, _out);
 
     } else if constexpr (std::is_same_v<S, dynamic::Drop>) {
-      return drop_to_sql(_s);
+      drop_to_sql(_s, _out);
 
     } else if constexpr (std::is_same_v<S, dynamic::Insert>) {
-      return insert_to_sql(_s);
+      insert_to_sql(_s, _out);
 
     } else if constexpr (std::is_same_v<S, dynamic::SelectFrom>) {
-      return select_from_to_sql(_s);
+      select_from_to_sql(_s, _out);
 
     } else if constexpr (std::is_same_v<S, dynamic::Update>) {
-      return update_to_sql(_s);
+      update_to_sql(_s, _out);
 
     } else if constexpr (std::is_same_v<S, dynamic::Write>) {
-      return write_to_sql(_s);
+      write_to_sql(_s, _out);
 
     } else {
       static_assert(rfl::always_false_v<S>, "Unsupported type.");
@@ -859,46 +896,40 @@ std::string type_to_sql(const dynamic::Type& _type) noexcept {
   });
 }
 
-std::string update_to_sql(const dynamic::Update& _stmt) noexcept {
-  using namespace std::ranges::views;
-
-  const auto to_str = [](const auto& _set) -> std::string {
-    return wrap_in_quotes(_set.col.name) + " = " +
-           column_or_value_to_sql(_set.to);
+void update_to_sql(const dynamic::Update& _stmt, std::string* _out) noexcept {
+  const auto set_to_sql = [](const auto& _set, std::string* _o) {
+    wrap_in_quotes(_set.col.name, _o);
+    _o->append(" = ");
+    column_or_value_to_sql(_set.to, _o);
   };
 
-  std::stringstream stream;
+  _out->append("UPDATE ");
 
-  stream << "UPDATE ";
+  table_to_sql(_stmt.table, _out);
 
-  if (_stmt.table.schema) {
-    stream << wrap_in_quotes(*_stmt.table.schema) << ".";
-  }
-  stream << wrap_in_quotes(_stmt.table.name);
-
-  stream << " SET ";
+  _out->append(" SET ");
 
-  stream << internal::strings::join(
-      ", ", internal::collect::vector(_stmt.sets | transform(to_str)));
+  internal::strings::join_into(", ", _stmt.sets, set_to_sql, _out);
 
   if (_stmt.where) {
-    stream << " WHERE " << condition_to_sql(*_stmt.where);
+    _out->append(" WHERE ");
+    condition_to_sql(*_stmt.where, _out);
   }
 
-  stream << ";";
-
-  return stream.str();
+  _out->push_back(';');
 }
 
-std::string write_to_sql(const dynamic::Write& _stmt) noexcept {
-  using namespace std::ranges::views;
-  const auto schema = wrap_in_quotes(_stmt.table.schema.value_or("public"));
-  const auto table = wrap_in_quotes(_stmt.table.name);
-  const auto colnames = internal::strings::join(
-      ", ",
-      internal::collect::vector(_stmt.columns | transform(wrap_in_quotes)));
-  return "COPY " + schema + "." + table + "(" + colnames +
-         ") FROM STDIN WITH DELIMITER '\t' NULL '\e' CSV QUOTE '\a';";
+void write_to_sql(const dynamic::Write& _stmt, std::string* _out) noexcept {
+  _out->append("COPY ");
+  wrap_in_quotes(_stmt.table.schema.value_or("public"), _out);
+  _out->push_back('.');
+  wrap_in_quotes(_stmt.table.name, _out);
+  _out->push_back('(');
+  internal::strings::join_into(
+      ", ", _stmt.columns,
+      [](const std::string& _c, std::string* _o) { wrap_in_quotes(_c, _o); },
+      _out);
+  _out->append(") FROM STDIN WITH DELIMITER '\t' NULL '\e' CSV QUOTE '\a';");
 }
 
 }  // namespace sqlgen::postgres
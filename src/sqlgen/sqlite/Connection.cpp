@@ -15,17 +15,18 @@ Connection::Connection(const std::string& _fname)
 
 Connection::~Connection() = default;
 
-Result<Nothing> Connection::actual_insert(
-    const std::vector<std::vector<std::optional<std::string>>>& _data,
-    sqlite3_stmt* _stmt) const noexcept {
-  for (const auto& row : _data) {
+Result<Nothing> Connection::actual_insert(const internal::RowBatch& _data,
+                                          sqlite3_stmt* _stmt) const noexcept {
+  for (size_t r = 0; r < _data.size(); ++r) {
+    const auto row = _data[r];
     const auto num_cols = static_cast<int>(row.size());
 
     for (int i = 0; i < num_cols; ++i) {
-      if (row[i]) {
+      const auto j = static_cast<size_t>(i);
+      if (const auto ptr = row.c_str(j)) {
         const auto res =
-            sqlite3_bind_text(_stmt, i + 1, row[i]->c_str(),
-                              static_cast<int>(row[i]->size()), SQLITE_STATIC);
+            sqlite3_bind_text(_stmt, i + 1, ptr,
+                              static_cast<int>(row.length(j)), SQLITE_STATIC);
         if (res != SQLITE_OK) {
           return error(sqlite3_errmsg(conn_.get()));
         }
@@ -83,11 +84,8 @@ Result<Nothing> Connection::execute(const std::string& _sql) noexcept {
 }
 
 Result<Nothing> Connection::insert_impl(
-    const dynamic::Insert& _stmt,
-    const std::vector<std::vector<std::optional<std::string>>>&
-        _data) noexcept {
-  const auto sql = to_sql_impl(_stmt);
-  return prepare_statement(sql).and_then(
+    const std::string& _sql, const internal::RowBatch& _data) noexcept {
+  return prepare_statement(_sql).and_then(
       [&](auto _p_stmt) { return actual_insert(_data, _p_stmt.get()); });
 }
 
@@ -101,16 +99,14 @@ typename Connection::ConnPtr Connection::make_conn(const std::string& _fname) {
   return ConnPtr::make(std::shared_ptr<sqlite3>(conn, &sqlite3_close)).value();
 }
 
-Result<Ref<Iterator>> Connection::read_impl(const dynamic::SelectFrom& _query) {
-  const auto sql = to_sql_impl(_query);
-
+Result<Ref<Iterator>> Connection::read_impl(const std::string& _sql) {
   sqlite3_stmt* p_stmt = nullptr;
 
-  sqlite3_prepare_v2(conn_.get(), /* Database handle */
-                     sql.c_str(), /* SQL statement, UTF-8 encoded */
-                     sql.size(),  /* Maximum length of zSql in bytes. */
-                     &p_stmt,     /* OUT: Statement handle */
-                     nullptr      /* OUT: Pointer to unused portion of zSql */
+  sqlite3_prepare_v2(conn_.get(),  /* Database handle */
+                     _sql.c_str(), /* SQL statement, UTF-8 encoded */
+                     _sql.size(),  /* Maximum length of zSql in bytes. */
+                     &p_stmt,      /* OUT: Statement handle */
+                     nullptr       /* OUT: Pointer to unused portion of zSql */
   );
 
   if (!p_stmt) {
@@ -147,15 +143,17 @@ std::string Connection::to_sql(const dynamic::Statement& _stmt) noexcept {
 }
 
 Result<Nothing> Connection::start_write(const dynamic::Write& _stmt) {
+  return start_write(to_sql_impl(_stmt));
+}
+
+Result<Nothing> Connection::start_write(const std::string& _sql) {
   if (stmt_) {
     return error(
         "A write operation has already been launched. You need to call "
         ".end_write() before you can start another.");
   }
 
-  const auto sql = to_sql_impl(_stmt);
-
-  return prepare_statement(sql)
+  return prepare_statement(_sql)
       .transform([&](auto&& _stmt) {
         stmt_ = std::move(_stmt);
         return Nothing{};
@@ -163,8 +161,7 @@ Result<Nothing> Connection::start_write(const dynamic::Write& _stmt) {
       .and_then([&](const auto&) { return begin_transaction(); });
 }
 
-Result<Nothing> Connection::write_impl(
-    const std::vector<std::vector<std::optional<std::string>>>& _data) {
+Result<Nothing> Connection::write_impl(const internal::RowBatch& _data) {
   if (!stmt_) {
     return error(
         " You need to call .start_write(...) before you can call "
@@ -3,9 +3,8 @@
 #include <ranges>
 #include <rfl.hpp>
 #include <sstream>
+#include <string_view>
 
-#include "sqlgen/internal/collect/vector.hpp"
-#include "sqlgen/internal/strings/strings.hpp"
 #include "sqlgen/sqlite/Iterator.hpp"
 
 namespace sqlgen::sqlite {
@@ -23,32 +22,31 @@ Iterator::~Iterator() = default;
 
 bool Iterator::end() const { return end_; }
 
-Result<std::vector<std::vector<std::optional<std::string>>>> Iterator::next(
-    const size_t _batch_size) {
+Result<internal::RowBatch> Iterator::next(const size_t _batch_size,
+                                          const size_t _batch_bytes) {
   if (end()) {
     return error("End is reached.");
   }
 
-  std::vector<std::vector<std::optional<std::string>>> batch;
+  internal::RowBatch batch;
 
   for (size_t i = 0; i < _batch_size; ++i) {
-    std::vector<std::optional<std::string>> new_row;
-
     for (int j = 0; j < num_cols_; ++j) {
       auto ptr = sqlite3_column_text(stmt_.get(), j);
       if (ptr) {
-        new_row.emplace_back(
-            std::string(std::launder(reinterpret_cast<const char*>(ptr))));
+        batch.append(std::string_view(
+            std::launder(reinterpret_cast<const char*>(ptr)),
+            static_cast<size_t>(sqlite3_column_bytes(stmt_.get(), j))));
       } else {
-        new_row.emplace_back(std::nullopt);
+        batch.append_null();
       }
     }
 
-    batch.emplace_back(std::move(new_row));
+    batch.end_row();
 
     step();
 
-    if (end()) {
+    if (end() || (_batch_bytes != 0 && batch.num_bytes() >= _batch_bytes)) {
       return batch;
     }
   }
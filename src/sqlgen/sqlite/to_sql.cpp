@@ -1,6 +1,5 @@
 #include <ranges>
 #include <rfl.hpp>
-#include <sstream>
 
 #include "sqlgen/dynamic/Join.hpp"
 #include "sqlgen/dynamic/Operation.hpp"
@@ -11,750 +10,768 @@
 
 namespace sqlgen::sqlite {
 
-std::string aggregation_to_sql(
-    const dynamic::Aggregation& _aggregation) noexcept;
+void aggregation_to_sql(const dynamic::Aggregation& _aggregation,
+                        std::string* _out) noexcept;
 
-std::string column_or_value_to_sql(const dynamic::ColumnOrValue& _col) noexcept;
+void column_or_value_to_sql(const dynamic::ColumnOrValue& _col,
+                            std::string* _out) noexcept;
 
-std::string column_to_sql_definition(const dynamic::Column& _col) noexcept;
+void column_to_sql_definition(const dynamic::Column& _col,
+                              std::string* _out) noexcept;
 
-std::string condition_to_sql(const dynamic::Condition& _cond) noexcept;
+void condition_to_sql(const dynamic::Condition& _cond,
+                      std::string* _out) noexcept;
 
 template <class ConditionType>
-std::string condition_to_sql_impl(const ConditionType& _condition) noexcept;
+void condition_to_sql_impl(const ConditionType& _condition,
+                           std::string* _out) noexcept;
 
-std::string create_index_to_sql(const dynamic::CreateIndex& _stmt) noexcept;
+void create_index_to_sql(const dynamic::CreateIndex& _stmt,
+                         std::string* _out) noexcept;
 
-std::string create_table_to_sql(const dynamic::CreateTable& _stmt) noexcept;
+void create_table_to_sql(const dynamic::CreateTable& _stmt,
+                         std::string* _out) noexcept;
 
-std::string create_as_to_sql(const dynamic::CreateAs& _stmt) noexcept;
+void create_as_to_sql(const dynamic::CreateAs& _stmt,
+                      std::string* _out) noexcept;
 
-std::string delete_from_to_sql(const dynamic::DeleteFrom& _stmt) noexcept;
+void delete_from_to_sql(const dynamic::DeleteFrom& _stmt,
+                        std::string* _out) noexcept;
 
-std::string drop_to_sql(const dynamic::Drop& _stmt) noexcept;
+void drop_to_sql(const dynamic::Drop& _stmt, std::string* _out) noexcept;
 
-std::string escape_single_quote(const std::string& _str) noexcept;
+void escape_single_quote(const std::string& _str, std::string* _out) noexcept;
 
-std::string field_to_str(const dynamic::SelectFrom::Field& _field) noexcept;
+void field_to_str(const dynamic::SelectFrom::Field& _field,
+                  std::string* _out) noexcept;
 
 template <class InsertOrWrite>
-std::string insert_or_write_to_sql(const InsertOrWrite& _stmt) noexcept;
+void insert_or_write_to_sql(const InsertOrWrite& _stmt,
+                            std::string* _out) noexcept;
 
-std::string join_to_sql(const dynamic::Join& _stmt) noexcept;
+void join_to_sql(const dynamic::Join& _stmt, std::string* _out) noexcept;
 
-std::string operation_to_sql(const dynamic::Operation& _stmt) noexcept;
+void operation_to_sql(const dynamic::Operation& _stmt,
+                      std::string* _out) noexcept;
 
-std::string properties_to_sql(const dynamic::types::Properties& _p) noexcept;
+void properties_to_sql(const dynamic::types::Properties& _p,
+                       std::string* _out) noexcept;
 
-std::string select_from_to_sql(const dynamic::SelectFrom& _stmt) noexcept;
+void select_from_to_sql(const dynamic::SelectFrom& _stmt,
+                        std::string* _out) noexcept;
 
-std::string table_or_query_to_sql(
-    const dynamic::SelectFrom::TableOrQueryType& _table_or_query) noexcept;
+void table_or_query_to_sql(
+    const dynamic::SelectFrom::TableOrQueryType& _table_or_query,
+    std::string* _out) noexcept;
 
 std::string type_to_sql(const dynamic::Type& _type) noexcept;
 
-std::string update_to_sql(const dynamic::Update& _stmt) noexcept;
+void update_to_sql(const dynamic::Update& _stmt, std::string* _out) noexcept;
 
 // ----------------------------------------------------------------------------
 
-inline std::string get_name(const dynamic::Column& _col) { return _col.name; }
+inline void wrap_in_quotes(const std::string& _name,
+                           std::string* _out) noexcept {
+  _out->push_back('"');
+  _out->append(_name);
+  _out->push_back('"');
+}
 
-inline std::string wrap_in_quotes(const std::string& _name) noexcept {
-  return "\"" + _name + "\"";
+inline void table_to_sql(const dynamic::Table& _table,
+                         std::string* _out) noexcept {
+  if (_table.schema) {
+    wrap_in_quotes(*_table.schema, _out);
+    _out->push_back('.');
+  }
+  wrap_in_quotes(_table.name, _out);
+}
+
+/// Writes "<_prefix><op1><_infix><op2><_suffix>".
+inline void binary_operation_to_sql(const std::string_view _prefix,
+                                    const dynamic::Operation& _op1,
+                                    const std::string_view _infix,
+                                    const dynamic::Operation& _op2,
+                                    const std::string_view _suffix,
+                                    std::string* _out) noexcept {
+  _out->append(_prefix);
+  operation_to_sql(_op1, _out);
+  _out->append(_infix);
+  operation_to_sql(_op2, _out);
+  _out->append(_suffix);
+}
+
+/// Writes "<_prefix><op><_suffix>".
+inline void unary_operation_to_sql(const std::string_view _prefix,
+                                   const dynamic::Operation& _op,
+                                   const std::string_view _suffix,
+                                   std::string* _out) noexcept {
+  _out->append(_prefix);
+  operation_to_sql(_op, _out);
+  _out->append(_suffix);
 }
 
 // ----------------------------------------------------------------------------
 
-std::string aggregation_to_sql(
-    const dynamic::Aggregation& _aggregation) noexcept {
-  return _aggregation.val.visit([](const auto& _agg) -> std::string {
+void aggregation_to_sql(const dynamic::Aggregation& _aggregation,
+                        std::string* _out) noexcept {
+  _aggregation.val.visit([&](const auto& _agg) {
     using Type = std::remove_cvref_t<decltype(_agg)>;
-    std::stringstream stream;
     if constexpr (std::is_same_v<Type, dynamic::Aggregation::Avg>) {
-      stream << "AVG(" << operation_to_sql(*_agg.val) << ")";
+      unary_operation_to_sql("AVG(", *_agg.val, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Aggregation::Count>) {
-      const auto val =
-          std::string(_agg.val && _agg.distinct ? "DISTINCT " : "") +
-          (_agg.val ? column_or_value_to_sql(*_agg.val) : std::string("*"));
-      stream << "COUNT(" << val << ")";
+      _out->append("COUNT(");
+      if (_agg.val) {
+        if (_agg.distinct) {
+          _out->append("DISTINCT ");
+        }
+        column_or_value_to_sql(*_agg.val, _out);
+      } else {
+        _out->push_back('*');
+      }
+      _out->push_back(')');
 
     } else if constexpr (std::is_same_v<Type, dynamic::Aggregation::Max>) {
-      stream << "MAX(" << operation_to_sql(*_agg.val) << ")";
+      unary_operation_to_sql("MAX(", *_agg.val, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Aggregation::Min>) {
-      stream << "MIN(" << operation_to_sql(*_agg.val) << ")";
+      unary_operation_to_sql("MIN(", *_agg.val, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Aggregation::Sum>) {
-      stream << "SUM(" << operation_to_sql(*_agg.val) << ")";
+      unary_operation_to_sql("SUM(", *_agg.val, ")", _out);
 
     } else {
       static_assert(rfl::always_false_v<Type>, "Not all cases were covered.");
     }
-    return stream.str();
   });
 }
 
-std::string pad_with_zeros(const std::string& _str,
-                           const size_t _expected_length) {
-  if (_str.size() < _expected_length) {
-    return std::string(_expected_length - _str.size(), '0') + _str;
-  } else {
-    return _str;
+void append_padded(const int64_t _val, const size_t _expected_length,
+                   std::string* _out) {
+  const auto str = std::to_string(_val);
+  if (str.size() < _expected_length) {
+    _out->append(_expected_length - str.size(), '0');
   }
+  _out->append(str);
 }
 
-std::string column_or_value_to_sql(
-    const dynamic::ColumnOrValue& _col) noexcept {
-  const auto handle_value = [](const auto& _v) -> std::string {
+void column_or_value_to_sql(const dynamic::ColumnOrValue& _col,
+                            std::string* _out) noexcept {
+  const auto handle_value = [&](const auto& _v) {
     using Type = std::remove_cvref_t<decltype(_v)>;
     if constexpr (std::is_same_v<Type, dynamic::String>) {
-      return "'" + escape_single_quote(_v.val) + "'";
+      _out->push_back('\'');
+      escape_single_quote(_v.val, _out);
+      _out->push_back('\'');
 
     } else if constexpr (std::is_same_v<Type, dynamic::Duration>) {
-      const auto prefix = std::string("'") + (_v.val >= 0 ? "+" : "-");
+      _out->push_back('\'');
+      _out->push_back(_v.val >= 0 ? '+' : '-');
       const auto val = std::abs(_v.val);
       switch (_v.unit) {
-        case dynamic::TimeUnit::milliseconds: {
-          const auto h = (val / 3600000);
-          const auto m = (val / 60000) % 60;
-          const auto s = (val / 1000) % 60;
-          const auto ms = val % 1000;
-          return prefix + pad_with_zeros(std::to_string(h), 2) + ":" +
-                 pad_with_zeros(std::to_string(m), 2) + ":" +
-                 pad_with_zeros(std::to_string(s), 2) + "." +
-                 pad_with_zeros(std::to_string(ms), 3) + "'";
-        }
+        case dynamic::TimeUnit::milliseconds:
+          append_padded(val / 3600000, 2, _out);
+          _out->push_back(':');
+          append_padded((val / 60000) % 60, 2, _out);
+          _out->push_back(':');
+          append_padded((val / 1000) % 60, 2, _out);
+          _out->push_back('.');
+          append_padded(val % 1000, 3, _out);
+          _out->push_back('\'');
+          break;
 
         case dynamic::TimeUnit::weeks:
-          return prefix + std::to_string(val * 7) + " days'";
+          _out->append(std::to_string(val * 7));
+          _out->append(" days'");
+          break;
 
         default:
-          return prefix + std::to_string(val) + " " +
-                 rfl::enum_to_string(_v.unit) + "'";
+          _out->append(std::to_string(val));
+          _out->push_back(' ');
+          _out->append(rfl::enum_to_string(_v.unit));
+          _out->push_back('\'');
+          break;
       }
 
     } else if constexpr (std::is_same_v<Type, dynamic::Timestamp>) {
-      return std::to_string(_v.seconds_since_unix);
+      _out->append(std::to_string(_v.seconds_since_unix));
 
     } else {
-      return std::to_string(_v.val);
+      _out->append(std::to_string(_v.val));
     }
   };
 
-  return _col.visit([&](const auto& _c) -> std::string {
+  _col.visit([&](const auto& _c) {
     using Type = std::remove_cvref_t<decltype(_c)>;
     if constexpr (std::is_same_v<Type, dynamic::Column>) {
       if (_c.alias) {
-        return *_c.alias + "." + wrap_in_quotes(_c.name);
-      } else {
-        return wrap_in_quotes(_c.name);
+        _out->append(*_c.alias);
+        _out->push_back('.');
       }
+      wrap_in_quotes(_c.name, _out);
     } else {
-      return _c.val.visit(handle_value);
+      _c.val.visit(handle_value);
     }
   });
 }
 
-std::string column_to_sql_definition(const dynamic::Column& _col) noexcept {
-  return "\"" + _col.name + "\"" + " " + type_to_sql(_col.type) +
-         properties_to_sql(
-             _col.type.visit([](const auto& _t) { return _t.properties; }));
+void column_to_sql_definition(const dynamic::Column& _col,
+                              std::string* _out) noexcept {
+  wrap_in_quotes(_col.name, _out);
+  _out->push_back(' ');
+  _out->append(type_to_sql(_col.type));
+  properties_to_sql(
+      _col.type.visit([](const auto& _t) { return _t.properties; }), _out);
 }
 
-std::string condition_to_sql(const dynamic::Condition& _cond) noexcept {
-  return _cond.val.visit(
-      [&](const auto& _c) { return condition_to_sql_impl(_c); });
+void condition_to_sql(const dynamic::Condition& _cond,
+                      std::string* _out) noexcept {
+  _cond.val.visit([&](const auto& _c) { condition_to_sql_impl(_c, _out); });
 }
 
 template <class ConditionType>
-std::string condition_to_sql_impl(const ConditionType& _condition) noexcept {
-  using namespace std::ranges::views;
-
+void condition_to_sql_impl(const ConditionType& _condition,
+                           std::string* _out) noexcept {
   using C = std::remove_cvref_t<ConditionType>;
 
-  std::stringstream stream;
+  const auto value_to_sql = [](const dynamic::Value& _v, std::string* _o) {
+    column_or_value_to_sql(_v, _o);
+  };
 
   if constexpr (std::is_same_v<C, dynamic::Condition::And>) {
-    stream << "(" << condition_to_sql(*_condition.cond1) << ") AND ("
-           << condition_to_sql(*_condition.cond2) << ")";
+    _out->push_back('(');
+    condition_to_sql(*_condition.cond1, _out);
+    _out->append(") AND (");
+    condition_to_sql(*_condition.cond2, _out);
+    _out->push_back(')');
 
   } else if constexpr (std::is_same_v<
                            C, dynamic::Condition::BooleanColumnOrValue>) {
-    stream << column_or_value_to_sql(_condition.col_or_val);
+    column_or_value_to_sql(_condition.col_or_val, _out);
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::Equal>) {
-    stream << operation_to_sql(_condition.op1) << " = "
-           << operation_to_sql(_condition.op2);
+    binary_operation_to_sql("", _condition.op1, " = ", _condition.op2, "",
+                            _out);
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::GreaterEqual>) {
-    stream << operation_to_sql(_condition.op1)
-           << " >= " << operation_to_sql(_condition.op2);
+    binary_operation_to_sql("", _condition.op1, " >= ", _condition.op2, "",
+                            _out);
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::GreaterThan>) {
-    stream << operation_to_sql(_condition.op1) << " > "
-           << operation_to_sql(_condition.op2);
+    binary_operation_to_sql("", _condition.op1, " > ", _condition.op2, "",
+                            _out);
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::In>) {
-    stream << operation_to_sql(_condition.op) << " IN ("
-           << internal::strings::join(
-                  ", ",
-                  internal::collect::vector(_condition.patterns |
-                                            transform(column_or_value_to_sql)))
-           << ")";
+    operation_to_sql(_condition.op, _out);
+    _out->append(" IN (");
+    internal::strings::join_into(", ", _condition.patterns, value_to_sql, _out);
+    _out->push_back(')');
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::IsNull>) {
-    stream << operation_to_sql(_condition.op) << " IS NULL";
+    operation_to_sql(_condition.op, _out);
+    _out->append(" IS NULL");
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::IsNotNull>) {
-    stream << operation_to_sql(_condition.op) << " IS NOT NULL";
+    operation_to_sql(_condition.op, _out);
+    _out->append(" IS NOT NULL");
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::LesserEqual>) {
-    stream << operation_to_sql(_condition.op1)
-           << " <= " << operation_to_sql(_condition.op2);
+    binary_operation_to_sql("", _condition.op1, " <= ", _condition.op2, "",
+                            _out);
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::LesserThan>) {
-    stream << operation_to_sql(_condition.op1) << " < "
-           << operation_to_sql(_condition.op2);
+    binary_operation_to_sql("", _condition.op1, " < ", _condition.op2, "",
+                            _out);
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::Like>) {
-    stream << operation_to_sql(_condition.op) << " LIKE "
-           << column_or_value_to_sql(_condition.pattern);
+    operation_to_sql(_condition.op, _out);
+    _out->append(" LIKE ");
+    column_or_value_to_sql(_condition.pattern, _out);
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::Not>) {
-    stream << "NOT (" << condition_to_sql(*_condition.cond) << ")";
+    _out->append("NOT (");
+    condition_to_sql(*_condition.cond, _out);
+    _out->push_back(')');
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::NotEqual>) {
-    stream << operation_to_sql(_condition.op1)
-           << " != " << operation_to_sql(_condition.op2);
+    binary_operation_to_sql("", _condition.op1, " != ", _condition.op2, "",
+                            _out);
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::NotLike>) {
-    stream << operation_to_sql(_condition.op) << " NOT LIKE "
-           << column_or_value_to_sql(_condition.pattern);
+    operation_to_sql(_condition.op, _out);
+    _out->append(" NOT LIKE ");
+    column_or_value_to_sql(_condition.pattern, _out);
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::NotIn>) {
-    stream << operation_to_sql(_condition.op) << " NOT IN ("
-           << internal::strings::join(
-                  ", ",
-                  internal::collect::vector(_condition.patterns |
-                                            transform(column_or_value_to_sql)))
-           << ")";
+    operation_to_sql(_condition.op, _out);
+    _out->append(" NOT IN (");
+    internal::strings::join_into(", ", _condition.patterns, value_to_sql, _out);
+    _out->push_back(')');
 
   } else if constexpr (std::is_same_v<C, dynamic::Condition::Or>) {
-    stream << "(" << condition_to_sql(*_condition.cond1) << ") OR ("
-           << condition_to_sql(*_condition.cond2) << ")";
+    _out->push_back('(');
+    condition_to_sql(*_condition.cond1, _out);
+    _out->append(") OR (");
+    condition_to_sql(*_condition.cond2, _out);
+    _out->push_back(')');
 
   } else {
     static_assert(rfl::always_false_v<C>, "Not all cases were covered.");
   }
-  return stream.str();
 }
 
-std::string create_index_to_sql(const dynamic::CreateIndex& _stmt) noexcept {
-  using namespace std::ranges::views;
-
-  const auto in_quotes = [](const std::string& _str) -> std::string {
-    return "\"" + _str + "\"";
-  };
-
-  std::stringstream stream;
-
+void create_index_to_sql(const dynamic::CreateIndex& _stmt,
+                         std::string* _out) noexcept {
   if (_stmt.unique) {
-    stream << "CREATE UNIQUE INDEX ";
+    _out->append("CREATE UNIQUE INDEX ");
   } else {
-    stream << "CREATE INDEX ";
+    _out->append("CREATE INDEX ");
   }
 
   if (_stmt.if_not_exists) {
-    stream << "IF NOT EXISTS ";
+    _out->append("IF NOT EXISTS ");
   }
 
   if (_stmt.table.schema) {
-    stream << "\"" << *_stmt.table.schema << "\".";
+    wrap_in_quotes(*_stmt.table.schema, _out);
+    _out->push_back('.');
   }
-  stream << "\"" << _stmt.name << "\" ";
+  wrap_in_quotes(_stmt.name, _out);
 
-  stream << "ON " << "\"" << _stmt.table.name << "\"";
+  _out->append(" ON ");
+  wrap_in_quotes(_stmt.table.name, _out);
 
-  stream << "(";
-  stream << internal::strings::join(
-      ", ", internal::collect::vector(_stmt.columns | transform(in_quotes)));
-  stream << ")";
+  _out->push_back('(');
+  internal::strings::join_into(", ", _stmt.columns, wrap_in_quotes, _out);
+  _out->push_back(')');
 
   if (_stmt.where) {
-    stream << " WHERE " << condition_to_sql(*_stmt.where);
+    _out->append(" WHERE ");
+    condition_to_sql(*_stmt.where, _out);
   }
 
-  stream << ";";
-
-  return stream.str();
+  _out->push_back(';');
 }
 
-std::string create_table_to_sql(const dynamic::CreateTable& _stmt) noexcept {
-  using namespace std::ranges::views;
-
-  const auto col_to_sql = [&](const auto& _col) {
-    return column_to_sql_definition(_col);
-  };
-
-  std::stringstream stream;
-  stream << "CREATE TABLE ";
+void create_table_to_sql(const dynamic::CreateTable& _stmt,
+                         std::string* _out) noexcept {
+  _out->append("CREATE TABLE ");
 
   if (_stmt.if_not_exists) {
-    stream << "IF NOT EXISTS ";
-  }
-
-  if (_stmt.table.schema) {
-    stream << "\"" << *_stmt.table.schema << "\".";
+    _out->append("IF NOT EXISTS ");
   }
-  stream << "\"" << _stmt.table.name << "\" ";
 
-  stream << "(";
-  stream << internal::strings::join(
-      ", ", internal::collect::vector(_stmt.columns | transform(col_to_sql)));
-  stream << ");";
+  table_to_sql(_stmt.table, _out);
 
-  return stream.str();
+  _out->append(" (");
+  internal::strings::join_into(", ", _stmt.columns, column_to_sql_definition,
+                               _out);
+  _out->append(");");
 }
 
-std::string create_as_to_sql(const dynamic::CreateAs& _stmt) noexcept {
-  std::stringstream stream;
-
-  stream << "CREATE "
-         << internal::strings::replace_all(
-                internal::strings::to_upper(rfl::enum_to_string(_stmt.what)),
-                "_", " ")
-         << " ";
+void create_as_to_sql(const dynamic::CreateAs& _stmt,
+                      std::string* _out) noexcept {
+  _out->append("CREATE ");
+  _out->append(internal::strings::replace_all(
+      internal::strings::to_upper(rfl::enum_to_string(_stmt.what)), "_", " "));
+  _out->push_back(' ');
 
   if (_stmt.if_not_exists) {
-    stream << "IF NOT EXISTS ";
-  }
-
-  if (_stmt.table_or_view.schema) {
-    stream << wrap_in_quotes(*_stmt.table_or_view.schema) << ".";
+    _out->append("IF NOT EXISTS ");
   }
-  stream << wrap_in_quotes(_stmt.table_or_view.name) << " AS ";
 
-  stream << select_from_to_sql(_stmt.query);
+  table_to_sql(_stmt.table_or_view, _out);
+  _out->append(" AS ");
 
-  return stream.str();
+  select_from_to_sql(_stmt.query, _out);
 }
 
-std::string delete_from_to_sql(const dynamic::DeleteFrom& _stmt) noexcept {
-  std::stringstream stream;
-
-  stream << "DELETE FROM ";
+void delete_from_to_sql(const dynamic::DeleteFrom& _stmt,
+                        std::string* _out) noexcept {
+  _out->append("DELETE FROM ");
 
-  if (_stmt.table.schema) {
-    stream << "\"" << *_stmt.table.schema << "\".";
-  }
-  stream << "\"" << _stmt.table.name << "\"";
+  table_to_sql(_stmt.table, _out);
 
   if (_stmt.where) {
-    stream << " WHERE " << condition_to_sql(*_stmt.where);
+    _out->append(" WHERE ");
+    condition_to_sql(*_stmt.where, _out);
   }
 
-  stream << ";";
-
-  return stream.str();
+  _out->push_back(';');
 }
 
-std::string drop_to_sql(const dynamic::Drop& _stmt) noexcept {
-  std::stringstream stream;
-
-  stream << "DROP "
-         << internal::strings::replace_all(
-                internal::strings::to_upper(rfl::enum_to_string(_stmt.what)),
-                "_", " ")
-         << " ";
+void drop_to_sql(const dynamic::Drop& _stmt, std::string* _out) noexcept {
+  _out->append("DROP ");
+  _out->append(internal::strings::replace_all(
+      internal::strings::to_upper(rfl::enum_to_string(_stmt.what)), "_", " "));
+  _out->push_back(' ');
 
   if (_stmt.if_exists) {
-    stream << "IF EXISTS ";
+    _out->append("IF EXISTS ");
   }
 
-  if (_stmt.table.schema) {
-    stream << "\"" << *_stmt.table.schema << "\".";
-  }
-  stream << "\"" << _stmt.table.name << "\"";
-
-  stream << ";";
+  table_to_sql(_stmt.table, _out);
 
-  return stream.str();
+  _out->push_back(';');
 }
 
-std::string escape_single_quote(const std::string& _str) noexcept {
-  return internal::strings::replace_all(_str, "'", "''");
+void escape_single_quote(const std::string& _str, std::string* _out) noexcept {
+  internal::strings::append_replace_all(_str, '\'', "''", _out);
 }
 
-std::string field_to_str(const dynamic::SelectFrom::Field& _field) noexcept {
-  std::stringstream stream;
-
-  stream << operation_to_sql(_field.val);
+void field_to_str(const dynamic::SelectFrom::Field& _field,
+                  std::string* _out) noexcept {
+  operation_to_sql(_field.val, _out);
 
   if (_field.as) {
-    stream << " AS " << "\"" << *_field.as << "\"";
+    _out->append(" AS ");
+    wrap_in_quotes(*_field.as, _out);
   }
-
-  return stream.str();
 }
 
 template <class InsertOrWrite>
-std::string insert_or_write_to_sql(const InsertOrWrite& _stmt) noexcept {
-  using namespace std::ranges::views;
-
-  const auto in_quotes = [](const std::string& _str) -> std::string {
-    return "\"" + _str + "\"";
+void insert_or_write_to_sql(const InsertOrWrite& _stmt,
+                            std::string* _out) noexcept {
+  const auto to_questionmark = [](const std::string&, std::string* _o) {
+    _o->push_back('?');
   };
 
-  const auto to_questionmark = [](const std::string&) -> std::string {
-    return "?";
+  const auto as_excluded = [](const std::string& _str, std::string* _o) {
+    _o->append(_str);
+    _o->append("=excluded.");
+    _o->append(_str);
   };
 
-  const auto as_excluded = [](const std::string& _str) -> std::string {
-    return _str + "=excluded." + _str;
-  };
+  _out->append("INSERT INTO ");
 
-  std::stringstream stream;
-  stream << "INSERT INTO ";
+  table_to_sql(_stmt.table, _out);
 
-  if (_stmt.table.schema) {
-    stream << wrap_in_quotes(*_stmt.table.schema) << ".";
-  }
-  stream << wrap_in_quotes(_stmt.table.name);
+  _out->append(" (");
+  internal::strings::join_into(", ", _stmt.columns, wrap_in_quotes, _out);
+  _out->push_back(')');
 
-  stream << " (";
-  stream << internal::strings::join(
-      ", ", internal::collect::vector(_stmt.columns | transform(in_quotes)));
-  stream << ")";
-
-  stream << " VALUES (";
-  stream << internal::strings::join(
-      ", ",
-      internal::collect::vector(_stmt.columns | transform(to_questionmark)));
-  stream << ")";
+  _out->append(" VALUES (");
+  internal::strings::join_into(", ", _stmt.columns, to_questionmark, _out);
+  _out->push_back(')');
 
   if constexpr (std::is_same_v<InsertOrWrite, dynamic::Insert>) {
     if (_stmt.or_replace) {
-      stream << " ON CONFLICT (";
-      stream << internal::strings::join(
-          ", ", internal::collect::vector(_stmt.constraints));
-      stream << ")";
-
-      stream << " DO UPDATE SET ";
-      stream << internal::strings::join(
-          ", ",
-          internal::collect::vector(_stmt.columns | transform(as_excluded)));
+      _out->append(" ON CONFLICT (");
+      internal::strings::join_into(
+          ", ", _stmt.constraints,
+          [](const std::string& _c, std::string* _o) { _o->append(_c); },
+          _out);
+      _out->push_back(')');
+
+      _out->append(" DO UPDATE SET ");
+      internal::strings::join_into(", ", _stmt.columns, as_excluded, _out);
     }
   }
 
-  stream << ';';
-  return stream.str();
+  _out->push_back(';');
 }
 
-std::string join_to_sql(const dynamic::Join& _stmt) noexcept {
-  std::stringstream stream;
-
-  stream << internal::strings::to_upper(internal::strings::replace_all(
-                rfl::enum_to_string(_stmt.how), "_", " "))
-         << " ";
+void join_to_sql(const dynamic::Join& _stmt, std::string* _out) noexcept {
+  _out->append(internal::strings::to_upper(internal::strings::replace_all(
+      rfl::enum_to_string(_stmt.how), "_", " ")));
+  _out->push_back(' ');
 
-  stream << table_or_query_to_sql(_stmt.table_or_query) << " ";
+  table_or_query_to_sql(_stmt.table_or_query, _out);
+  _out->push_back(' ');
 
-  stream << _stmt.alias << " ";
+  _out->append(_stmt.alias);
+  _out->push_back(' ');
 
   if (_stmt.on) {
-    stream << "ON " << condition_to_sql(*_stmt.on);
+    _out->append("ON ");
+    condition_to_sql(*_stmt.on, _out);
   } else {
-    stream << "ON 1 = 1";
+    _out->append("ON 1 = 1");
   }
-
-  return stream.str();
 }
 
-std::string operation_to_sql(const dynamic::Operation& _stmt) noexcept {
-  using namespace std::ranges::views;
-  return _stmt.val.visit([](const auto& _s) -> std::string {
-    using Type = std::remove_cvref_t<decltype(_s)>;
+void operation_to_sql(const dynamic::Operation& _stmt,
+                      std::string* _out) noexcept {
+  const auto ref_to_sql = [](const auto& _op, std::string* _o) {
+    operation_to_sql(*_op, _o);
+  };
 
-    std::stringstream stream;
+  _stmt.val.visit([&](const auto& _s) {
+    using Type = std::remove_cvref_t<decltype(_s)>;
 
     if constexpr (std::is_same_v<Type, dynamic::Operation::Abs>) {
-      stream << "abs(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("abs(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Aggregation>) {
-      stream << aggregation_to_sql(_s);
+      aggregation_to_sql(_s, _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Cast>) {
-      stream << "cast(" << operation_to_sql(*_s.op1) << " as "
-             << type_to_sql(_s.target_type) << ")";
+      unary_operation_to_sql("cast(", *_s.op1, " as ", _out);
+      _out->append(type_to_sql(_s.target_type));
+      _out->push_back(')');
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Coalesce>) {
-      stream << "coalesce("
-             << internal::strings::join(
-                    ", ", internal::collect::vector(
-                              _s.ops | transform([](const auto& _op) {
-                                return operation_to_sql(*_op);
-                              })))
-             << ")";
+      _out->append("coalesce(");
+      internal::strings::join_into(", ", _s.ops, ref_to_sql, _out);
+      _out->push_back(')');
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Ceil>) {
-      stream << "ceil(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("ceil(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Column>) {
-      stream << column_or_value_to_sql(_s);
+      column_or_value_to_sql(_s, _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Concat>) {
-      stream << "("
-             << internal::strings::join(
-                    " || ", internal::collect::vector(
-                                _s.ops | transform([](const auto& _op) {
-                                  return operation_to_sql(*_op);
-                                })))
-             << ")";
+      _out->push_back('(');
+      internal::strings::join_into(" || ", _s.ops, ref_to_sql, _out);
+      _out->push_back(')');
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Cos>) {
-      stream << "cos(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("cos(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Day>) {
-      stream << "cast(strftime('%d', " << operation_to_sql(*_s.op1)
-             << ") as INT)";
+      unary_operation_to_sql("cast(strftime('%d', ", *_s.op1, ") as INT)",
+                             _out);
 
     } else if constexpr (std::is_same_v<Type,
                                         dynamic::Operation::DaysBetween>) {
-      stream << "julianday(" << operation_to_sql(*_s.op2) << ") - julianday("
-             << operation_to_sql(*_s.op1) << ")";
+      binary_operation_to_sql("julianday(", *_s.op2, ") - julianday(", *_s.op1,
+                              ")", _out);
 
     } else if constexpr (std::is_same_v<Type,
                                         dynamic::Operation::DatePlusDuration>) {
-      stream << "datetime(" << operation_to_sql(*_s.date) << ", "
-             << internal::strings::join(
-                    ", ",
-                    internal::collect::vector(
-                        _s.durations | transform([](const auto& _d) {
-                          return column_or_value_to_sql(dynamic::Value{_d});
-                        })))
-             << ")";
+      unary_operation_to_sql("datetime(", *_s.date, ", ", _out);
+      internal::strings::join_into(
+          ", ", _s.durations,
+          [](const auto& _d, std::string* _o) {
+            column_or_value_to_sql(dynamic::Value{_d}, _o);
+          },
+          _out);
+      _out->push_back(')');
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Divides>) {
-      stream << "(" << operation_to_sql(*_s.op1) << ") / ("
-             << operation_to_sql(*_s.op2) << ")";
+      binary_operation_to_sql("(", *_s.op1, ") / (", *_s.op2, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Exp>) {
-      stream << "exp(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("exp(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Floor>) {
-      stream << "floor(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("floor(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Hour>) {
-      stream << "cast(strftime('%H', " << operation_to_sql(*_s.op1)
-             << ") as INT)";
+      unary_operation_to_sql("cast(strftime('%H', ", *_s.op1, ") as INT)",
+                             _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Length>) {
-      stream << "length(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("length(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Ln>) {
-      stream << "ln(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("ln(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Log2>) {
-      stream << "log2(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("log2(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Lower>) {
-      stream << "lower(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("lower(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::LTrim>) {
-      stream << "ltrim(" << operation_to_sql(*_s.op1) << ", "
-             << operation_to_sql(*_s.op2) << ")";
+      binary_operation_to_sql("ltrim(", *_s.op1, ", ", *_s.op2, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Minus>) {
-      stream << "(" << operation_to_sql(*_s.op1) << ") - ("
-             << operation_to_sql(*_s.op2) << ")";
+      binary_operation_to_sql("(", *_s.op1, ") - (", *_s.op2, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Minute>) {
-      stream << "cast(strftime('%M', " << operation_to_sql(*_s.op1)
-             << ") as INT)";
+      unary_operation_to_sql("cast(strftime('%M', ", *_s.op1, ") as INT)",
+                             _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Mod>) {
-      stream << "mod(" << operation_to_sql(*_s.op1) << ", "
-             << operation_to_sql(*_s.op2) << ")";
+      binary_operation_to_sql("mod(", *_s.op1, ", ", *_s.op2, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Month>) {
-      stream << "cast(strftime('%m', " << operation_to_sql(*_s.op1)
-             << ") as INT)";
+      unary_operation_to_sql("cast(strftime('%m', ", *_s.op1, ") as INT)",
+                             _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Multiplies>) {
-      stream << "(" << operation_to_sql(*_s.op1) << ") * ("
-             << operation_to_sql(*_s.op2) << ")";
+      binary_operation_to_sql("(", *_s.op1, ") * (", *_s.op2, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Plus>) {
-      stream << "(" << operation_to_sql(*_s.op1) << ") + ("
-             << operation_to_sql(*_s.op2) << ")";
+      binary_operation_to_sql("(", *_s.op1, ") + (", *_s.op2, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Replace>) {
-      stream << "replace(" << operation_to_sql(*_s.op1) << ", "
-             << operation_to_sql(*_s.op2) << ", " << operation_to_sql(*_s.op3)
-             << ")";
+      binary_operation_to_sql("replace(", *_s.op1, ", ", *_s.op2, ", ", _out);
+      unary_operation_to_sql("", *_s.op3, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Round>) {
-      stream << "round(" << operation_to_sql(*_s.op1) << ", "
-             << operation_to_sql(*_s.op2) << ")";
+      binary_operation_to_sql("round(", *_s.op1, ", ", *_s.op2, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::RTrim>) {
-      stream << "rtrim(" << operation_to_sql(*_s.op1) << ", "
-             << operation_to_sql(*_s.op2) << ")";
+      binary_operation_to_sql("rtrim(", *_s.op1, ", ", *_s.op2, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Second>) {
-      stream << "cast(strftime('%S', " << operation_to_sql(*_s.op1)
-             << ") as INT)";
+      unary_operation_to_sql("cast(strftime('%S', ", *_s.op1, ") as INT)",
+                             _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Sin>) {
-      stream << "sin(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("sin(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Sqrt>) {
-      stream << "sqrt(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("sqrt(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Tan>) {
-      stream << "tan(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("tan(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Trim>) {
-      stream << "trim(" << operation_to_sql(*_s.op1) << ", "
-             << operation_to_sql(*_s.op2) << ")";
+      binary_operation_to_sql("trim(", *_s.op1, ", ", *_s.op2, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Unixepoch>) {
-      stream << "unixepoch(" << operation_to_sql(*_s.op1) << ", 'subsec')";
+      unary_operation_to_sql("unixepoch(", *_s.op1, ", 'subsec')", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Upper>) {
-      stream << "upper(" << operation_to_sql(*_s.op1) << ")";
+      unary_operation_to_sql("upper(", *_s.op1, ")", _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Value>) {
-      stream << column_or_value_to_sql(_s);
+      column_or_value_to_sql(_s, _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Weekday>) {
-      stream << "cast(strftime('%w', " << operation_to_sql(*_s.op1)
-             << ") as INT)";
+      unary_operation_to_sql("cast(strftime('%w', ", *_s.op1, ") as INT)",
+                             _out);
 
     } else if constexpr (std::is_same_v<Type, dynamic::Operation::Year>) {
-      stream << "cast(strftime('%Y', " << operation_to_sql(*_s.op1)
-             << ") as INT)";
+      unary_operation_to_sql("cast(strftime('%Y', ", *_s.op1, ") as INT)",
+                             _out);
 
     } else {
       static_assert(rfl::always_false_v<Type>, "Unsupported type.");
     }
-    return stream.str();
   });
 }
 
-std::string properties_to_sql(const dynamic::types::Properties& _p) noexcept {
-  return [&]() -> std::string {
-    return std::string(_p.primary ? " PRIMARY KEY" : "") +
-           std::string(_p.auto_incr ? " AUTOINCREMENT" : "") +
-           std::string(_p.nullable ? "" : " NOT NULL") +
-           std::string(_p.unique ? " UNIQUE" : "");
-  }() + [&]() -> std::string {
-    if (!_p.foreign_key_reference) {
-      return "";
-    }
+void properties_to_sql(const dynamic::types::Properties& _p,
+                       std::string* _out) noexcept {
+  if (_p.primary) {
+    _out->append(" PRIMARY KEY");
+  }
+  if (_p.auto_incr) {
+    _out->append(" AUTOINCREMENT");
+  }
+  if (!_p.nullable) {
+    _out->append(" NOT NULL");
+  }
+  if (_p.unique) {
+    _out->append(" UNIQUE");
+  }
+  if (_p.foreign_key_reference) {
     const auto& ref = *_p.foreign_key_reference;
-    return " REFERENCES " + wrap_in_quotes(ref.table) + "(" +
-           wrap_in_quotes(ref.column) + ")";
-  }();
+    _out->append(" REFERENCES ");
+    wrap_in_quotes(ref.table, _out);
+    _out->push_back('(');
+    wrap_in_quotes(ref.column, _out);
+    _out->push_back(')');
+  }
 }
 
-std::string select_from_to_sql(const dynamic::SelectFrom& _stmt) noexcept {
-  using namespace std::ranges::views;
-
-  const auto order_by_to_str = [](const auto& _w) -> std::string {
-    return column_or_value_to_sql(_w.column) + (_w.desc ? " DESC" : "");
+void select_from_to_sql(const dynamic::SelectFrom& _stmt,
+                        std::string* _out) noexcept {
+  const auto column_to_sql = [](const dynamic::Column& _c, std::string* _o) {
+    column_or_value_to_sql(_c, _o);
   };
 
-  std::stringstream stream;
+  const auto order_by_to_str = [](const auto& _w, std::string* _o) {
+    column_or_value_to_sql(_w.column, _o);
+    if (_w.desc) {
+      _o->append(" DESC");
+    }
+  };
 
-  stream << "SELECT ";
-  stream << internal::strings::join(
-      ", ", internal::collect::vector(_stmt.fields | transform(field_to_str)));
+  _out->append("SELECT ");
+  internal::strings::join_into(", ", _stmt.fields, field_to_str, _out);
 
-  stream << " FROM " << table_or_query_to_sql(_stmt.table_or_query);
+  _out->append(" FROM ");
+  table_or_query_to_sql(_stmt.table_or_query, _out);
 
   if (_stmt.alias) {
-    stream << " " << *_stmt.alias;
+    _out->push_back(' ');
+    _out->append(*_stmt.alias);
   }
 
   if (_stmt.joins) {
-    stream << " "
-           << internal::strings::join(
-                  " ", internal::collect::vector(*_stmt.joins |
-                                                 transform(join_to_sql)));
+    _out->push_back(' ');
+    internal::strings::join_into(" ", *_stmt.joins, join_to_sql, _out);
   }
 
   if (_stmt.where) {
-    stream << " WHERE " << condition_to_sql(*_stmt.where);
+    _out->append(" WHERE ");
+    condition_to_sql(*_stmt.where, _out);
   }
 
   if (_stmt.group_by) {
-    stream << " GROUP BY "
-           << internal::strings::join(
-                  ", ",
-                  internal::collect::vector(_stmt.group_by->columns |
-                                            transform(column_or_value_to_sql)));
+    _out->append(" GROUP BY ");
+    internal::strings::join_into(", ", _stmt.group_by->columns, column_to_sql,
+                                 _out);
   }
 
   if (_stmt.order_by) {
-    stream << " ORDER BY "
-           << internal::strings::join(
-                  ", ", internal::collect::vector(_stmt.order_by->columns |
-                                                  transform(order_by_to_str)));
+    _out->append(" ORDER BY ");
+    internal::strings::join_into(", ", _stmt.order_by->columns,
+                                 order_by_to_str, _out);
   }
 
   if (_stmt.limit) {
-    stream << " LIMIT " << _stmt.limit->val;
+    _out->append(" LIMIT ");
+    _out->append(std::to_string(_stmt.limit->val));
   }
-
-  return stream.str();
 }
 
-std::string table_or_query_to_sql(
-    const dynamic::SelectFrom::TableOrQueryType& _table_or_query) noexcept {
-  return _table_or_query.visit([](const auto& _t) -> std::string {
+void table_or_query_to_sql(
+    const dynamic::SelectFrom::TableOrQueryType& _table_or_query,
+    std::string* _out) noexcept {
+  _table_or_query.visit([&](const auto& _t) {
     using Type = std::remove_cvref_t<decltype(_t)>;
     if constexpr (std::is_same_v<Type, dynamic::Table>) {
-      if (_t.schema) {
-        return wrap_in_quotes(*_t.schema) + "." + wrap_in_quotes(_t.name);
-      }
-      return wrap_in_quotes(_t.name);
+      table_to_sql(_t, _out);
     } else {
-      return "(" + select_from_to_sql(*_t) + ")";
+      _out->push_back('(');
+      select_from_to_sql(*_t, _out);
+      _out->push_back(')');
     }
   });
 }
 
 std::string to_sql_impl(const dynamic::Statement& _stmt) noexcept {
-  return _stmt.visit([&](const auto& _s) -> std::string {
+  std::string sql;
+  to_sql_into(_stmt, &sql);
+  return sql;
+}
+
+void to_sql_into(const dynamic::Statement& _stmt, std::string* _out) noexcept {
+  _stmt.visit([&](const auto& _s) {
     using S = std::remove_cvref_t<decltype(_s)>;
     if constexpr (std::is_same_v<S, dynamic::CreateIndex>) {
-      return create_index_to_sql(_s);
+      create_index_to_sql(_s, _out);
 
     } else if constexpr (std::is_same_v<S, dynamic::CreateTable>) {
-      return create_table_to_sql(_s);
+      create_table_to_sql(_s, _out);
 
     } else if constexpr (std::is_same_v<S, dynamic::CreateAs>) {
-      return create_as_to_sql(_s);
+      create_as_to_sql(_s, _out);
 
     } else if constexpr (std::is_same_v<S, dynamic::DeleteFrom>) {
-      return delete_from_to_sql(_s);
+      delete_from_to_sql(_s, _out);
 
     } else if constexpr (std::is_same_v<S, dynamic::Drop>) {
-      return drop_to_sql(_s);
+      drop_to_sql(_s, _out);
 
     } else if constexpr (std::is_same_v<S, dynamic::Insert>) {
-      return insert_or_write_to_sql(_s);
+      insert_or_write_to_sql(_s, _out);
 
     } else if constexpr (std::is_same_v<S, dynamic::SelectFrom>) {
-      return select_from_to_sql(_s);
+      select_from_to_sql(_s, _out);
 
     } else if constexpr (std::is_same_v<S, dynamic::Update>) {
-      return update_to_sql(_s);
+      update_to_sql(_s, _out);
 
     } else if constexpr (std::is_same_v<S, dynamic::Write>) {
-      return insert_or_write_to_sql(_s);
+      insert_or_write_to_sql(_s, _out);
 
     } else {
       static_assert(rfl::always_false_v<S>, "Unsupported type.");
@@ -802,34 +819,27 @@ std::string type_to_sql(const dynamic::Type& _type) noexcept {
   });
 }
 
-std::string update_to_sql(const dynamic::Update& _stmt) noexcept {
-  using namespace std::ranges::views;
-
-  const auto to_str = [](const auto& _set) -> std::string {
-    return "\"" + _set.col.name + "\" = " + column_or_value_to_sql(_set.to);
+void update_to_sql(const dynamic::Update& _stmt, std::string* _out) noexcept {
+  const auto set_to_sql = [](const auto& _set, std::string* _o) {
+    wrap_in_quotes(_set.col.name, _o);
+    _o->append(" = ");
+    column_or_value_to_sql(_set.to, _o);
   };
 
-  std::stringstream stream;
+  _out->append("UPDATE ");
 
-  stream << "UPDATE ";
+  table_to_sql(_stmt.table, _out);
 
-  if (_stmt.table.schema) {
-    stream << "\"" << *_stmt.table.schema << "\".";
-  }
-  stream << "\"" << _stmt.table.name << "\"";
+  _out->append(" SET ");
 
-  stream << " SET ";
-
-  stream << internal::strings::join(
-      ", ", internal::collect::vector(_stmt.sets | transform(to_str)));
+  internal::strings::join_into(", ", _stmt.sets, set_to_sql, _out);
 
   if (_stmt.where) {
-    stream << " WHERE " << condition_to_sql(*_stmt.where);
+    _out->append(" WHERE ");
+    condition_to_sql(*_stmt.where, _out);
   }
 
-  stream << ";";
-
-  return stream.str();
+  _out->push_back(';');
 }
 
 }  // namespace sqlgen::sqlite
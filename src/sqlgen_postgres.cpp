@@ -1,4 +1,5 @@
 #include "sqlgen/postgres/Connection.cpp"
+#include "sqlgen/postgres/InvalidationListener.cpp"
 #include "sqlgen/postgres/Iterator.cpp"
 #include "sqlgen/postgres/exec.cpp"
 #include "sqlgen/postgres/to_sql.cpp"
@@ -0,0 +1,84 @@
+#ifndef SQLGEN_BUILD_DRY_TESTS_ONLY
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <sqlgen.hpp>
+#include <sqlgen/postgres.hpp>
+#include <string>
+#include <thread>
+
+namespace test_cache_invalidation_listener {
+
+struct User {
+  std::string name;
+  int age;
+};
+
+TEST(postgres, test_cache_invalidation_listener) {
+  using namespace sqlgen;
+  using namespace sqlgen::literals;
+
+  const auto credentials = postgres::Credentials{.user = "postgres",
+                                                 .password = "password",
+                                                 .host = "localhost",
+                                                 .dbname = "postgres"};
+
+  const auto conn = postgres::connect(credentials);
+
+  (drop<User> | if_exists)(conn).value();
+
+  write(conn, User{.name = "John", .age = 30}).value();
+
+  const auto listener = postgres::listen_for_invalidations(credentials).value();
+
+  const auto cached_query =
+      cache<100>(sqlgen::read<User> | where("name"_c == "John"));
+
+  EXPECT_EQ(cached_query(conn).value().age, 30);
+
+  // This is what another process would do, if its connection had
+  // notify_invalidation set. The raw SQL does not invalidate anything in
+  // this process, so only the listener can.
+  conn.and_then(exec(R"(UPDATE "User" SET "age" = 31;)"))
+      .and_then(exec("NOTIFY sqlgen_invalidate, 'User';"))
+      .value();
+
+  auto age = cached_query(conn).value().age;
+  for (int i = 0; i < 50 && age != 31; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    age = cached_query(conn).value().age;
+  }
+
+  EXPECT_EQ(age, 31);
+
+  // Now the write goes through sqlgen on a connection that announces it.
+  auto notifying_credentials = credentials;
+  notifying_credentials.notify_invalidation = true;
+
+  const auto writer = postgres::connect(notifying_credentials);
+
+  const auto transaction = begin_transaction(writer)
+                               .and_then(update<User>("age"_c.set(32)))
+                               .value();
+
+  // The write is not visible yet, so the old age is cached again.
+  EXPECT_EQ(cached_query(conn).value().age, 31);
+
+  // Committing through the raw connection leaves the table versions in
+  // this process alone, so only the notification, which PostgreSQL
+  // delivers on commit, can invalidate the cached result.
+  transaction->execute("COMMIT;").value();
+
+  age = cached_query(conn).value().age;
+  for (int i = 0; i < 50 && age != 32; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    age = cached_query(conn).value().age;
+  }
+
+  EXPECT_EQ(age, 32);
+}
+
+}  // namespace test_cache_invalidation_listener
+
+#endif
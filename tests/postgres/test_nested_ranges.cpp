@@ -0,0 +1,77 @@
+#ifndef SQLGEN_BUILD_DRY_TESTS_ONLY
+
+#include <gtest/gtest.h>
+
+#include <rfl.hpp>
+#include <sqlgen.hpp>
+#include <sqlgen/postgres.hpp>
+#include <vector>
+
+namespace test_nested_ranges {
+
+struct Person {
+  sqlgen::PrimaryKey<uint32_t> id;
+  std::string first_name;
+  std::string last_name;
+  int age;
+};
+
+TEST(postgres, test_nested_ranges) {
+  const auto people1 = std::vector<Person>(
+      {Person{
+           .id = 0, .first_name = "Homer", .last_name = "Simpson", .age = 45},
+       Person{.id = 1, .first_name = "Bart", .last_name = "Simpson", .age = 10},
+       Person{.id = 2, .first_name = "Lisa", .last_name = "Simpson", .age = 8},
+       Person{
+           .id = 3, .first_name = "Maggie", .last_name = "Simpson", .age = 0}});
+
+  const auto credentials = sqlgen::postgres::Credentials{.user = "postgres",
+                                                         .password = "password",
+                                                         .host = "localhost",
+                                                         .dbname = "postgres"};
+
+  using namespace sqlgen;
+  using namespace sqlgen::literals;
+
+  const auto conn = sqlgen::postgres::connect(credentials)
+                        .and_then(drop<Person> | if_exists)
+                        .and_then(write(std::ref(people1)))
+                        .value();
+
+  // Both ranges stream through their own cursor on the same connection.
+  const auto outer =
+      sqlgen::read<sqlgen::Range<Person>> | order_by("id"_c) | batch_size(1);
+
+  // The results are bound first, because the temporary Result would be
+  // destroyed before the body of a range-based for loop runs.
+  size_t num_pairs = 0;
+  const auto parents = outer(conn).value();
+  for (const auto& parent : parents) {
+    const auto inner = sqlgen::read<sqlgen::Range<Person>> |
+                       where("age"_c < parent.value().age) | batch_size(1);
+    const auto children = inner(conn).value();
+    for (const auto& child : children) {
+      EXPECT_LT(child.value().age, parent.value().age);
+      ++num_pairs;
+    }
+  }
+
+  EXPECT_EQ(num_pairs, 6);
+
+  // The transaction used by the cursors has been ended, so the connection
+  // can be used for transactions of its own.
+  const auto hugo =
+      Person{.id = 4, .first_name = "Hugo", .last_name = "Simpson", .age = 10};
+
+  const auto people2 = begin_transaction(conn)
+                           .and_then(insert(std::ref(hugo)))
+                           .and_then(rollback)
+                           .and_then(sqlgen::read<std::vector<Person>>)
+                           .value();
+
+  EXPECT_EQ(people2.size(), 4);
+}
+
+}  // namespace test_nested_ranges
+
+#endif
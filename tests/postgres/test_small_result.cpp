@@ -0,0 +1,76 @@
+#ifndef SQLGEN_BUILD_DRY_TESTS_ONLY
+
+#include <gtest/gtest.h>
+
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <sqlgen.hpp>
+#include <sqlgen/postgres.hpp>
+#include <vector>
+
+namespace test_small_result {
+
+struct Person {
+  sqlgen::PrimaryKey<uint32_t> id;
+  std::string first_name;
+  std::string last_name;
+  int age;
+};
+
+TEST(postgres, test_small_result) {
+  const auto people1 = std::vector<Person>(
+      {Person{
+           .id = 0, .first_name = "Homer", .last_name = "Simpson", .age = 45},
+       Person{.id = 1, .first_name = "Bart", .last_name = "Simpson", .age = 10},
+       Person{.id = 2, .first_name = "Lisa", .last_name = "Simpson", .age = 8},
+       Person{
+           .id = 3, .first_name = "Maggie", .last_name = "Simpson", .age = 0},
+       Person{
+           .id = 4, .first_name = "Hugo", .last_name = "Simpson", .age = 10}});
+
+  const auto credentials = sqlgen::postgres::Credentials{.user = "postgres",
+                                                         .password = "password",
+                                                         .host = "localhost",
+                                                         .dbname = "postgres"};
+
+  using namespace sqlgen;
+  using namespace sqlgen::literals;
+
+  const auto conn =
+      sqlgen::postgres::connect(credentials).and_then(drop<Person> | if_exists);
+
+  sqlgen::write(conn, people1).value();
+
+  // A point lookup is fetched in a single round trip, without a cursor.
+  const auto lisa = (sqlgen::read<Person> | where("id"_c == 2))(conn).value();
+
+  EXPECT_EQ(lisa.first_name, "Lisa");
+
+  // The complete result is still handed out in batches.
+  const auto query = sqlgen::read<sqlgen::Range<Person>> | order_by("age"_c) |
+                     limit(3) | batch_size(2);
+
+  const auto people_range = query(conn).value();
+
+  std::vector<std::string> first_names;
+  for (const auto& person : people_range) {
+    first_names.emplace_back(person.value().first_name);
+  }
+
+  EXPECT_EQ(first_names, std::vector<std::string>({"Maggie", "Lisa", "Bart"}));
+
+  const auto people2 = (sqlgen::read<std::vector<Person>> |
+                        where("age"_c > 100) | limit(10))(conn)
+                           .value();
+
+  EXPECT_EQ(people2.size(), 0);
+
+  // The connection can still be used for cursors afterwards.
+  const auto people3 = sqlgen::read<std::vector<Person>>(conn).value();
+
+  EXPECT_EQ(people3.size(), 5);
+}
+
+}  // namespace test_small_result
+
+#endif
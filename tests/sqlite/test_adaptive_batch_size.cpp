@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+
+#include <rfl.hpp>
+#include <sqlgen.hpp>
+#include <sqlgen/sqlite.hpp>
+#include <vector>
+
+namespace test_adaptive_batch_size {
+
+struct Person {
+  sqlgen::PrimaryKey<uint32_t> id;
+  std::string first_name;
+  int age;
+};
+
+TEST(sqlite, test_adaptive_batch_size) {
+  using namespace sqlgen;
+  using namespace sqlgen::literals;
+
+  auto people1 = std::vector<Person>();
+  for (uint32_t i = 0; i < 1000; ++i) {
+    people1.emplace_back(Person{.id = i,
+                                .first_name = "Person " + std::to_string(i),
+                                .age = static_cast<int>(i % 100)});
+  }
+
+  const auto conn = sqlite::connect();
+
+  sqlgen::write(conn, people1);
+
+  // The batches have 1, 3, 9, 27, 81 and then 100 rows.
+  const auto people_range =
+      (sqlgen::read<sqlgen::Range<Person>> | order_by("id"_c) |
+       batch_size(100) | adaptive_batch_size(1, 3))(conn)
+          .value();
+
+  uint32_t expected_id = 0;
+  for (const auto& person : people_range) {
+    EXPECT_EQ(person.value().id(), expected_id);
+    ++expected_id;
+  }
+  EXPECT_EQ(expected_id, 1000);
+
+  const auto people2 = (sqlgen::read<std::vector<Person>> |
+                        adaptive_batch_size(10) | prefetch)(conn)
+                           .value();
+
+  EXPECT_EQ(people2.size(), 1000);
+}
+
+}  // namespace test_adaptive_batch_size
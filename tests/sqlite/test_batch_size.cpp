@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+
+#include <rfl.hpp>
+#include <sqlgen.hpp>
+#include <sqlgen/sqlite.hpp>
+#include <vector>
+
+namespace test_batch_size {
+
+struct Person {
+  sqlgen::PrimaryKey<uint32_t> id;
+  std::string first_name;
+  int age;
+};
+
+TEST(sqlite, test_batch_size) {
+  using namespace sqlgen;
+  using namespace sqlgen::literals;
+
+  auto people1 = std::vector<Person>();
+  for (uint32_t i = 0; i < 1000; ++i) {
+    people1.emplace_back(Person{.id = i,
+                                .first_name = "Person " + std::to_string(i),
+                                .age = static_cast<int>(i % 100)});
+  }
+
+  const auto people2 =
+      std::vector<Person>(people1.begin(), people1.begin() + 500);
+  const auto people3 =
+      std::vector<Person>(people1.begin() + 500, people1.end());
+
+  const auto conn = sqlite::connect()
+                        .and_then(write(std::ref(people2)) | batch_size(7))
+                        .and_then(insert(std::ref(people3)) | batch_bytes(100))
+                        .value();
+
+  const auto people_range =
+      (sqlgen::read<sqlgen::Range<Person>> | order_by("id"_c) |
+       batch_size(9) | batch_bytes(200))(conn)
+          .value();
+
+  uint32_t expected_id = 0;
+  for (const auto& person : people_range) {
+    EXPECT_EQ(person.value().id(), expected_id);
+    ++expected_id;
+  }
+  EXPECT_EQ(expected_id, 1000);
+
+  const auto people4 =
+      (sqlgen::read<std::vector<Person>> | where("age"_c < 10) |
+       batch_size(1))(conn)
+          .value();
+
+  EXPECT_EQ(people4.size(), 100);
+}
+
+}  // namespace test_batch_size
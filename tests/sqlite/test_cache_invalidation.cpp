@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+
+#include <sqlgen.hpp>
+#include <sqlgen/sqlite.hpp>
+#include <string>
+#include <vector>
+
+namespace test_cache_invalidation {
+
+struct User {
+  std::string name;
+  int age;
+};
+
+TEST(sqlite, test_cache_invalidation) {
+  using namespace sqlgen;
+  using namespace sqlgen::literals;
+
+  auto conn = sqlite::connect();
+
+  write(conn, User{.name = "John", .age = 30}).value();
+
+  const auto ages = [&]() {
+    auto ages = std::vector<int>();
+    for (const auto& u :
+         conn.and_then(cache(sqlgen::read<std::vector<User>> |
+                             order_by("name"_c)))
+             .value()) {
+      ages.push_back(u.age);
+    }
+    return ages;
+  };
+
+  EXPECT_EQ(ages(), std::vector<int>({30}));
+
+  // Raw SQL is not tracked, so the cached result is still served...
+  conn.and_then(exec(R"(UPDATE "User" SET "age" = 0;)")).value();
+  EXPECT_EQ(ages(), std::vector<int>({30}));
+
+  // ...but writes through sqlgen invalidate it.
+  conn.and_then(update<User>("age"_c.set(31))).value();
+  EXPECT_EQ(ages(), std::vector<int>({31}));
+
+  conn.and_then(insert(User{.name = "Jane", .age = 40})).value();
+  EXPECT_EQ(ages(), std::vector<int>({40, 31}));
+
+  conn = begin_transaction(conn)
+             .and_then(delete_from<User> | where("name"_c == "Jane"))
+             .and_then(commit);
+  EXPECT_EQ(ages(), std::vector<int>({31}));
+
+  conn.and_then(delete_from<User>).value();
+  EXPECT_EQ(ages(), std::vector<int>());
+}
+
+}  // namespace test_cache_invalidation
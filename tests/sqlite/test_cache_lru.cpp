@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include <sqlgen.hpp>
+#include <sqlgen/sqlite.hpp>
+#include <string>
+#include <vector>
+
+namespace test_cache_lru {
+
+struct User {
+  std::string name;
+  int age;
+};
+
+TEST(sqlite, test_cache_lru) {
+  using namespace sqlgen;
+  using namespace sqlgen::literals;
+
+  const auto conn = sqlite::connect();
+
+  const auto users = std::vector<User>({User{.name = "John", .age = 30},
+                                        User{.name = "Jane", .age = 40},
+                                        User{.name = "Jim", .age = 50}});
+
+  write(conn, users).value();
+
+  const auto get_age = [&](const std::string& _name) {
+    return conn
+        .and_then(cache<2>(sqlgen::read<User> | where("name"_c == _name)))
+        .value()
+        .age;
+  };
+
+  EXPECT_EQ(get_age("John"), 30);
+  EXPECT_EQ(get_age("Jane"), 40);
+
+  // John is now more recently used than Jane, so Jane is evicted next.
+  EXPECT_EQ(get_age("John"), 30);
+  EXPECT_EQ(get_age("Jim"), 50);
+
+  const auto query = cache<2>(sqlgen::read<User> | where("name"_c == "John"));
+
+  EXPECT_EQ(query.cache(conn).size(), 2);
+
+  // Raw SQL bypasses the invalidation, so we can tell which results are
+  // served from the cache.
+  conn.and_then(exec(R"(UPDATE "User" SET "age" = 0;)")).value();
+
+  // John and Jim are still served from the cache, Jane has to be read again.
+  EXPECT_EQ(get_age("John"), 30);
+  EXPECT_EQ(get_age("Jim"), 50);
+  EXPECT_EQ(get_age("Jane"), 0);
+}
+
+}  // namespace test_cache_lru
@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+
+#include <sqlgen.hpp>
+#include <sqlgen/sqlite.hpp>
+#include <string>
+#include <vector>
+
+namespace test_cache_max_bytes {
+
+struct User {
+  int id;
+  std::string description;
+};
+
+TEST(sqlite, test_cache_max_bytes) {
+  using namespace sqlgen;
+  using namespace sqlgen::literals;
+
+  const auto conn = sqlite::connect();
+
+  auto users = std::vector<User>();
+  for (int i = 0; i < 10; ++i) {
+    users.emplace_back(User{.id = i, .description = std::string(200, 'x')});
+  }
+
+  write(conn, users).value();
+
+  // Every result takes up a bit more than 200 bytes, so only a few of them
+  // fit into the budget.
+  for (int i = 0; i < 10; ++i) {
+    const auto user =
+        conn.and_then(cache<0, 1000>(sqlgen::read<User> | where("id"_c == i)))
+            .value();
+    EXPECT_EQ(user.id, i);
+  }
+
+  const auto& c = cache<0, 1000>(sqlgen::read<User> | where("id"_c == 0))
+                      .cache(conn);
+
+  EXPECT_LE(c.num_bytes(), 1000);
+  EXPECT_GE(c.size(), 2);
+  EXPECT_LT(c.size(), 10);
+}
+
+}  // namespace test_cache_max_bytes
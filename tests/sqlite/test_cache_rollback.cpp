@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+
+#include <sqlgen.hpp>
+#include <sqlgen/sqlite.hpp>
+#include <string>
+
+namespace test_cache_rollback {
+
+struct User {
+  std::string name;
+  int age;
+};
+
+TEST(sqlite, test_cache_rollback) {
+  using namespace sqlgen;
+  using namespace sqlgen::literals;
+
+  const auto conn = sqlite::connect();
+
+  write(conn, User{.name = "John", .age = 30}).value();
+
+  const auto query = cache(sqlgen::read<User> | where("name"_c == "John"));
+
+  // The transaction sees its own write and the result is cached...
+  const auto t1 =
+      begin_transaction(conn).and_then(update<User>("age"_c.set(31))).value();
+  EXPECT_EQ(query(t1).value().age, 31);
+
+  // ...but once the write is rolled back, it must not be served anymore.
+  rollback(t1).value();
+
+  const auto t2 = begin_transaction(conn).value();
+  EXPECT_EQ(query(t2).value().age, 30);
+  rollback(t2).value();
+
+  // The same goes for transactions that are rolled back implicitly.
+  {
+    const auto t3 = begin_transaction(conn)
+                        .and_then(update<User>("age"_c.set(32)))
+                        .value();
+    EXPECT_EQ(query(t3).value().age, 32);
+  }
+
+  const auto t4 = begin_transaction(conn).value();
+  EXPECT_EQ(query(t4).value().age, 30);
+  commit(t4).value();
+
+  EXPECT_EQ(query(conn).value().age, 30);
+}
+
+}  // namespace test_cache_rollback
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <sqlgen.hpp>
+#include <sqlgen/internal/LRUCache.hpp>
+#include <sqlgen/sqlite.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace test_cache_single_flight {
+
+struct User {
+  std::string name;
+  int age;
+};
+
+TEST(sqlite, test_cache_single_flight) {
+  using namespace sqlgen;
+  using namespace sqlgen::literals;
+
+  // A miss only schedules a query, if its future is the one that has been
+  // inserted. Of many threads looking for the same key at the same time,
+  // exactly one may insert.
+  auto lru = internal::LRUCache<int, int>(10);
+  auto start = std::atomic<bool>(false);
+  auto num_inserted = std::atomic<int>(0);
+  auto lru_threads = std::vector<std::thread>();
+  for (int i = 0; i < 16; ++i) {
+    lru_threads.emplace_back([&, i]() {
+      while (!start) {
+        std::this_thread::yield();
+      }
+      if (lru.get_or_put(1, i).second) {
+        ++num_inserted;
+      }
+    });
+  }
+  start = true;
+  for (auto& t : lru_threads) {
+    t.join();
+  }
+
+  EXPECT_EQ(num_inserted, 1);
+  EXPECT_EQ(lru.size(), 1);
+
+  const auto conn = sqlite::connect();
+
+  const auto users = std::vector<User>(
+      {User{.name = "John", .age = 30}, User{.name = "Jane", .age = 40}});
+
+  write(conn, users).value();
+
+  const auto query = cache(sqlgen::read<User> | where("name"_c == "John"));
+
+  // All threads miss at about the same time, but they share a single fetch,
+  // so there is only one entry and everybody gets the same result.
+  auto ages = std::vector<int>(16);
+  auto threads = std::vector<std::thread>();
+  for (size_t i = 0; i < ages.size(); ++i) {
+    threads.emplace_back(
+        [&, i]() { ages[i] = conn.and_then(query).value().age; });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  for (const auto age : ages) {
+    EXPECT_EQ(age, 30);
+  }
+
+  EXPECT_EQ(query.cache(conn).size(), 1);
+}
+
+}  // namespace test_cache_single_flight
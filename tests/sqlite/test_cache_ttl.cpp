@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <sqlgen.hpp>
+#include <sqlgen/sqlite.hpp>
+#include <string>
+#include <thread>
+
+namespace test_cache_ttl {
+
+struct User {
+  std::string name;
+  int age;
+};
+
+TEST(sqlite, test_cache_ttl) {
+  using namespace sqlgen;
+  using namespace sqlgen::literals;
+  using namespace std::chrono_literals;
+
+  // The refresh after the soft_ttl needs a session of its own, so the
+  // connections of the pool must share a database.
+  std::remove("test_cache_ttl.db");
+
+  const auto pool = make_connection_pool<sqlite::Connection>(
+      ConnectionPoolConfig{.size = 2}, std::string("test_cache_ttl.db"));
+
+  const auto conn = session(pool);
+
+  write(conn, User{.name = "John", .age = 30}).value();
+
+  const auto query = sqlgen::read<User> | where("name"_c == "John");
+
+  const auto with_ttl = cache<100>(query) | ttl(100ms);
+
+  const auto with_soft_ttl = cache<101>(query) | soft_ttl(100ms);
+
+  EXPECT_EQ(with_ttl(conn).value().age, 30);
+  EXPECT_EQ(with_soft_ttl(pool).value().age, 30);
+
+  // Raw SQL does not invalidate anything, so only the age of the cached
+  // results decides, whether the change is seen.
+  conn.and_then(exec(R"(UPDATE "User" SET "age" = 31;)")).value();
+
+  EXPECT_EQ(with_ttl(conn).value().age, 30);
+  EXPECT_EQ(with_soft_ttl(pool).value().age, 30);
+
+  std::this_thread::sleep_for(200ms);
+
+  // The expired result is fetched again right away...
+  EXPECT_EQ(with_ttl(conn).value().age, 31);
+
+  // ...but the stale one is still served, even to the caller that starts the
+  // refresh, which does not wait for it.
+  EXPECT_EQ(with_soft_ttl(pool).value().age, 30);
+
+  // The refresh replaces the stale result in the background.
+  const auto deadline = std::chrono::steady_clock::now() + 5s;
+  while (with_soft_ttl(pool).value().age != 31 &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_EQ(with_soft_ttl(pool).value().age, 31);
+
+  // The refreshed result is cached again.
+  conn.and_then(exec(R"(UPDATE "User" SET "age" = 32;)")).value();
+  EXPECT_EQ(with_soft_ttl(pool).value().age, 31);
+
+  std::remove("test_cache_ttl.db");
+}
+
+}  // namespace test_cache_ttl
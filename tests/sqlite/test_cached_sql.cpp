@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <sqlgen.hpp>
+#include <sqlgen/sqlite.hpp>
+#include <type_traits>
+#include <vector>
+
+namespace test_cached_sql {
+
+struct Person {
+  sqlgen::PrimaryKey<uint32_t> id;
+  std::string first_name;
+  int age;
+};
+
+TEST(sqlite, test_cached_sql) {
+  const auto people1 = std::vector<Person>(
+      {Person{.id = 0, .first_name = "Homer", .age = 45},
+       Person{.id = 1, .first_name = "Bart", .age = 10}});
+
+  const auto people2 = std::vector<Person>(
+      {Person{.id = 1, .first_name = "Bartholomew", .age = 10}});
+
+  using namespace sqlgen;
+  using namespace sqlgen::literals;
+
+  const auto conn = sqlite::connect();
+
+  // The plain INSERT and the INSERT OR REPLACE are memoized separately, so a
+  // plain insert must still fail on a duplicate key after insert_or_replace.
+  conn.and_then(create_table<Person>)
+      .and_then(insert(people1))
+      .and_then(insert_or_replace(people2))
+      .value();
+
+  EXPECT_FALSE(conn.and_then(insert(people2)));
+
+  const auto all1 = sqlgen::read<std::vector<Person>>(conn).value();
+  const auto all2 = sqlgen::read<std::vector<Person>>(conn).value();
+
+  const auto homer =
+      conn.and_then(sqlgen::read<Person> | where("age"_c > 18)).value();
+  const auto bart =
+      conn.and_then(sqlgen::read<Person> | where("age"_c < 18)).value();
+
+  const std::string expected =
+      R"([{"id":0,"first_name":"Homer","age":45},{"id":1,"first_name":"Bartholomew","age":10}])";
+
+  EXPECT_EQ(rfl::json::write(all1), expected);
+  EXPECT_EQ(rfl::json::write(all2), expected);
+  EXPECT_EQ(homer.first_name, "Homer");
+  EXPECT_EQ(bart.first_name, "Bartholomew");
+
+  conn.and_then(delete_from<Person>).value();
+
+  EXPECT_EQ(sqlgen::read<std::vector<Person>>(conn).value().size(), 0);
+
+  static_assert(
+      std::is_same_v<internal::dialect_t<Transaction<sqlite::Connection>>,
+                     sqlite::Connection>);
+
+  EXPECT_EQ(
+      (internal::insert_sql<Person, sqlite::Connection>()),
+      R"(INSERT INTO "Person" ("id", "first_name", "age") VALUES (?, ?, ?);)");
+}
+
+}  // namespace test_cached_sql
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <sqlgen.hpp>
+#include <sqlgen/sqlite.hpp>
+#include <thread>
+#include <vector>
+
+namespace test_connection_pool {
+
+TEST(sqlite, test_connection_pool) {
+  using namespace std::chrono_literals;
+
+  const auto pool = sqlgen::make_connection_pool<sqlgen::sqlite::Connection>(
+                        sqlgen::ConnectionPoolConfig{.min_size = 1,
+                                                     .max_size = 2,
+                                                     .timeout = 50ms,
+                                                     .idle_timeout = 10ms},
+                        std::string(":memory:"))
+                        .value();
+
+  EXPECT_EQ(pool.size(), 1);
+  EXPECT_EQ(pool.available(), 2);
+
+  {
+    auto session1 = sqlgen::session(pool).value();
+
+    // The second connection is only opened now.
+    auto session2 = sqlgen::session(pool).value();
+
+    EXPECT_EQ(pool.size(), 2);
+    EXPECT_EQ(pool.available(), 0);
+
+    // Times out after 50ms.
+    EXPECT_FALSE(sqlgen::session(pool));
+  }
+
+  EXPECT_EQ(pool.available(), 2);
+
+  // The connection beyond min_size is closed, once it has been idle for too
+  // long.
+  std::this_thread::sleep_for(20ms);
+  sqlgen::session(pool).value();
+
+  EXPECT_EQ(pool.size(), 1);
+}
+
+TEST(sqlite, test_connection_pool_fairness) {
+  using namespace std::chrono_literals;
+
+  const auto pool = sqlgen::make_connection_pool<sqlgen::sqlite::Connection>(
+                        sqlgen::ConnectionPoolConfig{.size = 1, .timeout = 5s},
+                        std::string(":memory:"))
+                        .value();
+
+  auto session = std::make_optional(sqlgen::session(pool).value());
+
+  std::mutex mtx;
+  std::vector<int> order;
+  std::vector<std::thread> threads;
+
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&, i]() {
+      const auto s = sqlgen::session(pool).value();
+      std::lock_guard<std::mutex> lock(mtx);
+      order.push_back(i);
+    });
+
+    // Every thread is queued, before the next one is started.
+    while (pool.metrics().num_waiting != static_cast<size_t>(i + 1)) {
+      std::this_thread::yield();
+    }
+  }
+
+  // The connection is handed to the waiting threads in the order they
+  // arrived.
+  session.reset();
+
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  EXPECT_EQ(order, std::vector<int>({0, 1, 2, 3}));
+}
+
+}  // namespace test_connection_pool
@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include <sqlgen.hpp>
+#include <sqlgen/sqlite.hpp>
+#include <vector>
+
+namespace test_connection_pool_init_sql {
+
+struct Person {
+  sqlgen::PrimaryKey<uint32_t> id;
+  std::string first_name;
+  int age;
+};
+
+TEST(sqlite, test_connection_pool_init_sql) {
+  using namespace sqlgen;
+
+  // Every connection has its own in-memory database, so the table only exists
+  // on connections the init_sql has been executed on.
+  const auto pool = make_connection_pool<sqlite::Connection>(
+      ConnectionPoolConfig{
+          .size = 4,
+          .init_sql = {"CREATE TABLE Person (id INTEGER PRIMARY KEY, "
+                       "first_name TEXT NOT NULL, age INTEGER NOT NULL);"}},
+      std::string(":memory:"));
+
+  auto sessions = std::vector<Ref<Session<sqlite::Connection>>>();
+  for (int i = 0; i < 4; ++i) {
+    sessions.emplace_back(session(pool).value());
+  }
+
+  for (const auto& s : sessions) {
+    EXPECT_EQ(sqlgen::read<std::vector<Person>>(s).value().size(), 0);
+  }
+
+  const auto failed_pool = make_connection_pool<sqlite::Connection>(
+      ConnectionPoolConfig{.size = 2, .init_sql = {"NOT VALID SQL;"}},
+      std::string(":memory:"));
+
+  EXPECT_FALSE(failed_pool);
+}
+
+}  // namespace test_connection_pool_init_sql
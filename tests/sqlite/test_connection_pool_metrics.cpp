@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <optional>
+#include <sqlgen.hpp>
+#include <sqlgen/sqlite.hpp>
+#include <thread>
+
+namespace test_connection_pool_metrics {
+
+TEST(sqlite, test_connection_pool_metrics) {
+  using namespace sqlgen;
+
+  const auto pool = make_connection_pool<sqlite::Connection>(
+      ConnectionPoolConfig{.size = 2,
+                           .timeout = std::chrono::milliseconds(10)},
+      std::string(":memory:"));
+
+  {
+    auto s1 = session(pool).value();
+    auto s2 = std::make_optional(session(pool).value());
+
+    const auto m = pool.value().metrics();
+    EXPECT_EQ(m.size, 2);
+    EXPECT_EQ(m.max_size, 2);
+    EXPECT_EQ(m.in_use, 2);
+    EXPECT_EQ(m.peak_in_use, 2);
+
+    EXPECT_FALSE(session(pool));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    s2.reset();
+  }
+
+  const auto m = pool.value().metrics();
+
+  EXPECT_EQ(m.in_use, 0);
+  EXPECT_EQ(m.peak_in_use, 2);
+  EXPECT_EQ(m.num_timeouts, 1);
+
+  // The timed out attempt does not count as a wait.
+  EXPECT_EQ(m.wait_time.count, 2);
+  EXPECT_EQ(m.hold_time.count, 2);
+  EXPECT_GE(m.hold_time.sum, std::chrono::milliseconds(10));
+
+  EXPECT_EQ(m.wait_time.counts.size(), m.wait_time.upper_bounds.size() + 1);
+
+  uint64_t count = 0;
+  for (size_t i = 0; i < m.hold_time.counts.size(); ++i) {
+    count += m.hold_time.counts[i];
+  }
+  EXPECT_EQ(count, m.hold_time.count);
+}
+
+}  // namespace test_connection_pool_metrics
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <sqlgen.hpp>
+#include <sqlgen/sqlite.hpp>
+#include <vector>
+
+namespace test_node_arena {
+
+struct Person {
+  sqlgen::PrimaryKey<uint32_t> id;
+  std::string first_name;
+  std::string last_name;
+  int age;
+};
+
+TEST(sqlite, test_node_arena) {
+  using namespace sqlgen;
+  using namespace sqlgen::literals;
+
+  const auto query = sqlgen::read<std::vector<Person>> |
+                     where("age"_c * 2 + 4 < 40 and "first_name"_c != "Hugo") |
+                     order_by("age"_c);
+
+  // The nodes are allocated in an arena that must outlive the scope they were
+  // created in, including in copies of the statement.
+  const auto stmt = [&]() {
+    const auto original = transpilation::to_sql(query);
+    return original;
+  }();
+
+  const auto other = transpilation::to_sql(
+      sqlgen::read<std::vector<Person>> | where("age"_c + 1 > 2));
+
+  const std::string expected =
+      R"(SELECT "id", "first_name", "last_name", "age" FROM "Person" WHERE ((("age") * (2)) + (4) < 40) AND ("first_name" != 'Hugo') ORDER BY "age")";
+
+  EXPECT_EQ(sqlite::to_sql(stmt), expected);
+  EXPECT_EQ(
+      sqlite::to_sql(other),
+      R"(SELECT "id", "first_name", "last_name", "age" FROM "Person" WHERE ("age") + (1) > 2)");
+
+  const auto people1 = std::vector<Person>(
+      {Person{
+           .id = 0, .first_name = "Homer", .last_name = "Simpson", .age = 45},
+       Person{.id = 1, .first_name = "Bart", .last_name = "Simpson", .age = 10},
+       Person{.id = 2, .first_name = "Lisa", .last_name = "Simpson", .age = 8},
+       Person{
+           .id = 3, .first_name = "Hugo", .last_name = "Simpson", .age = 10}});
+
+  const auto conn = sqlite::connect();
+
+  sqlgen::write(conn, people1);
+
+  const auto people2 = query(conn).value();
+
+  const std::string expected_people =
+      R"([{"id":2,"first_name":"Lisa","last_name":"Simpson","age":8},{"id":1,"first_name":"Bart","last_name":"Simpson","age":10}])";
+
+  EXPECT_EQ(rfl::json::write(people2), expected_people);
+}
+
+}  // namespace test_node_arena
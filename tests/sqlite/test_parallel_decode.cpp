@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <rfl.hpp>
+#include <sqlgen.hpp>
+#include <sqlgen/sqlite.hpp>
+#include <vector>
+
+namespace test_parallel_decode {
+
+struct Person {
+  sqlgen::PrimaryKey<uint32_t> id;
+  std::string first_name;
+  int age;
+};
+
+struct ValidatedPerson {
+  static constexpr const char* tablename = "Person";
+
+  sqlgen::PrimaryKey<uint32_t> id;
+  sqlgen::AlphaNumeric first_name;
+  int age;
+};
+
+TEST(sqlite, test_parallel_decode) {
+  using namespace sqlgen;
+  using namespace sqlgen::literals;
+
+  // Every seventh name fails the validation of ValidatedPerson.
+  auto people1 = std::vector<Person>();
+  for (uint32_t i = 0; i < 60000; ++i) {
+    people1.emplace_back(
+        Person{.id = i,
+               .first_name = (i % 7 == 0 ? "Person " : "Person") +
+                             std::to_string(i),
+               .age = static_cast<int>(i % 100)});
+  }
+
+  const auto conn = sqlite::connect();
+
+  sqlgen::write(conn, people1);
+
+  const auto people2 =
+      (sqlgen::read<std::vector<Person>> | parallel_decode(8))(conn).value();
+
+  ASSERT_EQ(people2.size(), people1.size());
+  for (size_t i = 0; i < people2.size(); ++i) {
+    EXPECT_EQ(people2[i].id(), people1[i].id());
+    EXPECT_EQ(people2[i].first_name, people1[i].first_name);
+  }
+
+  const auto people_range = (sqlgen::read<sqlgen::Range<ValidatedPerson>> |
+                             parallel_decode(8))(conn)
+                                .value();
+
+  uint32_t i = 0;
+  for (const auto& person : people_range) {
+    EXPECT_EQ(static_cast<bool>(person), i % 7 != 0);
+    ++i;
+  }
+  EXPECT_EQ(i, 60000);
+}
+
+}  // namespace test_parallel_decode
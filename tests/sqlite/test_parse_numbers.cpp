@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <sqlgen.hpp>
+#include <sqlgen/parsing/Parser.hpp>
+#include <string>
+
+namespace test_parse_numbers {
+
+template <class T>
+using Parser = sqlgen::parsing::Parser<T>;
+
+TEST(sqlite, test_parse_numbers) {
+  EXPECT_EQ(Parser<int32_t>::read("42").value(), 42);
+  EXPECT_EQ(Parser<int32_t>::read("-42").value(), -42);
+  EXPECT_EQ(Parser<int32_t>::read("+42").value(), 42);
+  EXPECT_EQ(Parser<int32_t>::read("7.000000").value(), 7);
+  EXPECT_EQ(Parser<int64_t>::read("9223372036854775807").value(),
+            std::numeric_limits<int64_t>::max());
+  EXPECT_EQ(Parser<uint64_t>::read("18446744073709551615").value(),
+            std::numeric_limits<uint64_t>::max());
+
+  EXPECT_FALSE(Parser<int32_t>::read("42abc"));
+  EXPECT_FALSE(Parser<int32_t>::read("7.5"));
+  EXPECT_FALSE(Parser<int32_t>::read(""));
+  EXPECT_FALSE(Parser<int32_t>::read(" 42"));
+  EXPECT_FALSE(Parser<int32_t>::read("+-42"));
+  EXPECT_FALSE(Parser<int32_t>::read(std::nullopt));
+  EXPECT_FALSE(Parser<int8_t>::read("128"));
+  EXPECT_FALSE(Parser<int16_t>::read("-32769"));
+  EXPECT_FALSE(Parser<uint32_t>::read("-1"));
+  EXPECT_FALSE(Parser<int64_t>::read("9223372036854775808"));
+
+  EXPECT_EQ(Parser<double>::read("1.5").value(), 1.5);
+  EXPECT_EQ(Parser<double>::read("-2.5e3").value(), -2500.0);
+  EXPECT_EQ(Parser<float>::read("0.25").value(), 0.25f);
+  EXPECT_FALSE(Parser<double>::read("1.5x"));
+  EXPECT_FALSE(Parser<double>::read(""));
+  EXPECT_FALSE(Parser<float>::read("1e100"));
+
+  EXPECT_TRUE(Parser<bool>::read("t").value());
+  EXPECT_TRUE(Parser<bool>::read("1").value());
+  EXPECT_FALSE(Parser<bool>::read("FALSE").value());
+  EXPECT_FALSE(Parser<bool>::read("0").value());
+  EXPECT_FALSE(Parser<bool>::read("yes"));
+
+  EXPECT_EQ(Parser<int32_t>::write(-42), "-42");
+  EXPECT_EQ(Parser<uint64_t>::write(std::numeric_limits<uint64_t>::max()),
+            "18446744073709551615");
+  EXPECT_EQ(Parser<bool>::write(true), "1");
+  EXPECT_EQ(Parser<double>::read(*Parser<double>::write(0.1)).value(), 0.1);
+  EXPECT_EQ(Parser<double>::read(*Parser<double>::write(1e-300)).value(),
+            1e-300);
+}
+
+}  // namespace test_parse_numbers
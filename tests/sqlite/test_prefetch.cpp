@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include <ranges>
+#include <rfl.hpp>
+#include <sqlgen.hpp>
+#include <sqlgen/sqlite.hpp>
+#include <vector>
+
+namespace test_prefetch {
+
+struct Person {
+  sqlgen::PrimaryKey<uint32_t> id;
+  std::string first_name;
+  int age;
+};
+
+TEST(sqlite, test_prefetch) {
+  using namespace sqlgen;
+  using namespace sqlgen::literals;
+
+  // More than two batches, so that at least one of them is prefetched.
+  auto people1 = std::vector<Person>();
+  for (uint32_t i = 0; i < 120000; ++i) {
+    people1.emplace_back(Person{.id = i,
+                                .first_name = "Person " + std::to_string(i),
+                                .age = static_cast<int>(i % 100)});
+  }
+
+  const auto conn = sqlite::connect();
+
+  sqlgen::write(conn, people1);
+
+  const auto people_range =
+      (sqlgen::read<sqlgen::Range<Person>> | prefetch)(conn).value();
+
+  uint32_t expected_id = 0;
+  for (const auto& person : people_range) {
+    EXPECT_EQ(person.value().id(), expected_id);
+    ++expected_id;
+  }
+  EXPECT_EQ(expected_id, 120000);
+
+  const auto people2 = (sqlgen::read<std::vector<Person>> | prefetch |
+                        where("age"_c < 10) | order_by("id"_c))(conn)
+                           .value();
+
+  EXPECT_EQ(people2.size(), 12000);
+  for (const auto& person : people2) {
+    EXPECT_LT(person.age, 10);
+  }
+}
+
+}  // namespace test_prefetch
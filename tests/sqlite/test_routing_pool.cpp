@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <sqlgen.hpp>
+#include <sqlgen/sqlite.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace test_routing_pool {
+
+struct Person {
+  sqlgen::PrimaryKey<uint32_t> id;
+  std::string first_name;
+  int age;
+};
+
+TEST(sqlite, test_routing_pool) {
+  using namespace sqlgen;
+  using namespace sqlgen::literals;
+
+  // The primary and the replica are separate in-memory databases, so we can
+  // tell where a statement has been sent by looking at the data.
+  const auto make_pool = [](const std::string& _first_name) {
+    return make_connection_pool<sqlite::Connection>(
+        ConnectionPoolConfig{
+            .size = 1,
+            .init_sql = {"CREATE TABLE Person (id INTEGER PRIMARY KEY, "
+                         "first_name TEXT NOT NULL, age INTEGER NOT NULL);",
+                         "INSERT INTO Person VALUES (0, '" + _first_name +
+                             "', 0);"}},
+        std::string(":memory:"));
+  };
+
+  const auto pool = make_routing_pool<sqlite::Connection>(
+      make_pool("Primary"), {make_pool("Replica")},
+      RoutingPoolConfig{.pin_to_primary_after_write =
+                            std::chrono::milliseconds(200)});
+
+  const auto first_name = [&]() {
+    return session(pool)
+        .and_then(sqlgen::read<Person> | where("id"_c == 0))
+        .value()
+        .first_name;
+  };
+
+  EXPECT_EQ(first_name(), "Replica");
+
+  const auto people = std::vector<Person>(
+      {Person{.id = 1, .first_name = "Homer", .age = 45}});
+
+  session(pool).and_then(insert(std::ref(people))).value();
+
+  // Right after the write, reads are pinned to the primary...
+  EXPECT_EQ(first_name(), "Primary");
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+  // ...but then they go back to the replica, which never saw the insert.
+  EXPECT_EQ(first_name(), "Replica");
+
+  // Reads inside a transaction always go to the primary.
+  const auto in_transaction = session(pool)
+                                  .and_then(begin_transaction)
+                                  .and_then(sqlgen::read<std::vector<Person>>)
+                                  .value();
+
+  EXPECT_EQ(in_transaction.size(), 2);
+
+  // If the replica cannot hand out a connection, the read falls back to the
+  // primary right away, instead of waiting for the replica's timeout.
+  auto replica = pool.value().replicas().at(0);
+  const auto held = replica.acquire().value();
+
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(first_name(), "Primary");
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+}
+
+}  // namespace test_routing_pool